@@ -0,0 +1,54 @@
+#!/bin/bash
+
+# fourth-order true SDC on an AMR hierarchy.  This is the same test as
+# convergence_sdc4.sh, but each run refines the pulse by MAX_LEVEL
+# levels (the refinement criteria are in the inputs files), so the
+# coarse-fine ghost cell fills and the reflux of the SDC fluxes are
+# exercised.  The Richardson test then compares the composite
+# solutions.
+#
+# The fine levels can limit the level 0 timestep, so the number of
+# steps is not assumed to match the single-level runs: each
+# comparison uses the last plotfile written by the run.
+
+# echo the commands
+set -x
+
+DIM=2
+EXEC=./Castro${DIM}d.gnu.MPI.TRUESDC.ex
+
+MAX_LEVEL=${MAX_LEVEL:-2}
+
+RUNPARAMS="
+castro.sdc_order=4
+castro.time_integration_method=2
+castro.limit_fourth_order=1
+castro.use_reconstructed_gamma1=1
+castro.sdc_solve_for_rhoe=1
+castro.sdc_solver_tol_dens=1.e-10
+castro.sdc_solver_tol_spec=1.e-10
+castro.sdc_solver_tol_ener=1.e-10
+castro.sdc_solver=1
+castro.use_retry=0
+amr.max_level=${MAX_LEVEL}
+amr.blocking_factor=8
+amr.n_error_buf=2"
+
+mpiexec -n 8 ${EXEC}  inputs.64 ${RUNPARAMS} amr.plot_file=react_converge_amr_64_plt &> 64.amr.out
+mpiexec -n 16 ${EXEC} inputs.128 ${RUNPARAMS} amr.plot_file=react_converge_amr_128_plt &> 128.amr.out
+mpiexec -n 16 ${EXEC} inputs.256 ${RUNPARAMS} amr.plot_file=react_converge_amr_256_plt &> 256.amr.out
+
+plt64=`ls -d react_converge_amr_64_plt* | tail -1`
+plt128=`ls -d react_converge_amr_128_plt* | tail -1`
+plt256=`ls -d react_converge_amr_256_plt* | tail -1`
+
+RichardsonConvergenceTest${DIM}d.gnu.ex coarFile=${plt64} mediFile=${plt128} fineFile=${plt256} > convergence.${DIM}d.lo.sdc4.amr.out
+
+mpiexec -n 16 ${EXEC} inputs.512 ${RUNPARAMS} amr.plot_file=react_converge_amr_512_plt &> 512.amr.out
+
+plt512=`ls -d react_converge_amr_512_plt* | tail -1`
+
+RichardsonConvergenceTest${DIM}d.gnu.ex coarFile=${plt128} mediFile=${plt256} fineFile=${plt512} > convergence.${DIM}d.hi.sdc4.amr.out
+
+# the measured orders
+python3 analysis/create_pretty_tables.py --simple convergence.${DIM}d.lo.sdc4.amr.out convergence.${DIM}d.hi.sdc4.amr.out
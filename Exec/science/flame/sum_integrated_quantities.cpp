@@ -33,25 +33,40 @@ Castro::sum_integrated_quantities ()
   Real flame_width = 0.0;
   Real flame_speed = 0.0;
 
+  // everything the state gives us is summed in one pass over each level;
+  // the center of mass uses the volume-weighted density moments, the
+  // same as the main diagnostics
+
+  Vector<std::string> sum_names = {"density", "xmom", "ymom", "zmom",
+                                   "rho_e", "kineng", "rho_E"};
+  if (show_center_of_mass) {
+    sum_names.push_back("density_moment_x");
+    sum_names.push_back("density_moment_y");
+    sum_names.push_back("density_moment_z");
+  }
+  Vector<Real> sums;
+
   for (int lev = 0; lev <= finest_level; lev++)
     {
       Castro& ca_lev = getLevel(lev);
 
-      mass   += ca_lev.volWgtSum("density", time, local_flag);
-      mom[0] += ca_lev.volWgtSum("xmom", time, local_flag);
-      mom[1] += ca_lev.volWgtSum("ymom", time, local_flag);
-      mom[2] += ca_lev.volWgtSum("zmom", time, local_flag);
+      ca_lev.volWgtSums(sum_names, time, sums, local_flag);
+
+      mass   += sums[0];
+      mom[0] += sums[1];
+      mom[1] += sums[2];
+      mom[2] += sums[3];
+
+      rho_e += sums[4];
+      rho_K += sums[5];
+      rho_E += sums[6];
 
       if (show_center_of_mass) {
-        com[0] += ca_lev.locWgtSum("density", time, 0, local_flag);
-        com[1] += ca_lev.locWgtSum("density", time, 1, local_flag);
-        com[2] += ca_lev.locWgtSum("density", time, 2, local_flag);
+        com[0] += sums[7];
+        com[1] += sums[8];
+        com[2] += sums[9];
       }
 
-      rho_e += ca_lev.volWgtSum("rho_e", time, local_flag);
-      rho_K += ca_lev.volWgtSum("kineng", time, local_flag);
-      rho_E += ca_lev.volWgtSum("rho_E", time, local_flag);
-
 
       ca_lev.flame_width_properties(time, T_max, T_min, grad_T_max);
 
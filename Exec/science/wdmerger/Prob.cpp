@@ -665,11 +665,21 @@ void Castro::check_to_stop(Real time, bool dump) {
             bool local_flag = true;
             bool fine_mask = false;
 
-            rho_E += volWgtSum("rho_E", curTime,  local_flag, fine_mask);
+            Vector<std::string> sum_names = {"rho_E"};
+#ifdef GRAVITY
+            if (do_grav) {
+                sum_names.push_back("rho_phiGrav");
+            }
+#endif
+            Vector<Real> sums;
+
+            volWgtSums(sum_names, curTime, sums, local_flag, fine_mask);
+
+            rho_E += sums[0];
 
 #ifdef GRAVITY
             if (do_grav) {
-                rho_phi += volWgtSum("rho_phiGrav", curTime,  local_flag, fine_mask);
+                rho_phi += sums[1];
             }
 #endif
 
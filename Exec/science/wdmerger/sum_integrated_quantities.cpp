@@ -98,6 +98,32 @@ Castro::sum_integrated_quantities ()
 
     wd_dist_init[problem::axis_1 - 1] = 1.0;
 
+    // Everything but the rotational potential energy comes from a single
+    // pass over each level. The center of mass uses the volume-weighted
+    // density moments.
+
+    amrex::Vector<std::string> sum_names = {"density",
+                                            "density_moment_x", "density_moment_y", "density_moment_z",
+                                            "inertial_momentum_x", "inertial_momentum_y", "inertial_momentum_z",
+                                            "inertial_angular_momentum_x", "inertial_angular_momentum_y", "inertial_angular_momentum_z",
+                                            "rho_E", "kineng", "rho_e"};
+
+#ifdef HYBRID_MOMENTUM
+    const int ihybrid = sum_names.size();
+    sum_names.push_back("rmom");
+    sum_names.push_back("lmom");
+    sum_names.push_back("pmom");
+#endif
+
+#ifdef GRAVITY
+    const int irho_phi = sum_names.size();
+    if (do_grav) {
+      sum_names.push_back("rho_phiGrav");
+    }
+#endif
+
+    amrex::Vector<Real> sums;
+
     for (int lev = 0; lev <= finest_level; lev++)
     {
 
@@ -105,35 +131,28 @@ Castro::sum_integrated_quantities ()
 
       Castro& ca_lev = getLevel(lev);
 
-      for ( int i = 0; i < 3; i++ ) {
-        com[i] += ca_lev.locWgtSum("density", time, i, local_flag);
-      }
-
       // Calculate total mass, momentum, angular momentum, and energy of system.
 
-      mass += ca_lev.volWgtSum("density", time, local_flag);
-
-      momentum[0] += ca_lev.volWgtSum("inertial_momentum_x", time, local_flag);
-      momentum[1] += ca_lev.volWgtSum("inertial_momentum_y", time, local_flag);
-      momentum[2] += ca_lev.volWgtSum("inertial_momentum_z", time, local_flag);
+      ca_lev.volWgtSums(sum_names, time, sums, local_flag);
 
-      angular_momentum[0] += ca_lev.volWgtSum("inertial_angular_momentum_x", time, local_flag);
-      angular_momentum[1] += ca_lev.volWgtSum("inertial_angular_momentum_y", time, local_flag);
-      angular_momentum[2] += ca_lev.volWgtSum("inertial_angular_momentum_z", time, local_flag);
+      mass += sums[0];
 
+      for ( int i = 0; i < 3; i++ ) {
+        com[i] += sums[1+i];
+        momentum[i] += sums[4+i];
+        angular_momentum[i] += sums[7+i];
 #ifdef HYBRID_MOMENTUM
-      hybrid_momentum[0] += ca_lev.volWgtSum("rmom", time, local_flag);
-      hybrid_momentum[1] += ca_lev.volWgtSum("lmom", time, local_flag);
-      hybrid_momentum[2] += ca_lev.volWgtSum("pmom", time, local_flag);
+        hybrid_momentum[i] += sums[ihybrid+i];
 #endif
+      }
 
-      rho_E += ca_lev.volWgtSum("rho_E", time, local_flag);
-      rho_K += ca_lev.volWgtSum("kineng",time, local_flag);
-      rho_e += ca_lev.volWgtSum("rho_e", time, local_flag);
+      rho_E += sums[10];
+      rho_K += sums[11];
+      rho_e += sums[12];
 
 #ifdef GRAVITY
       if (do_grav)
-        rho_phi += ca_lev.volProductSum("density", "phiGrav", time, local_flag);
+        rho_phi += sums[irho_phi];
 #endif
 
 #ifdef ROTATION
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# convergence of the implicit (Crank-Nicolson) diffusion update with
+# 2 levels of refinement.  Subcycling is off, so each step does one
+# composite implicit solve across both levels.  The timestep is
+# fixed and halved with each refinement, so the L-inf error against
+# the analytic solution should drop by about 4x per refinement.
+#
+# The L-inf error and the run time of each run are collected in
+# ${ofile}, one line per resolution.
+
+DIM=2
+EXEC=./Castro${DIM}d.gnu.ex
+
+METHOD=${METHOD:-2}
+
+ofile=convergence_implicit.${DIM}d.method${METHOD}.out
+
+RUNPARAMS="
+diffusion.implicit_method=${METHOD}
+amr.subcycling_mode=None
+castro.use_retry=0"
+
+echo "# base resolution    L-inf error    run time (s)" > ${ofile}
+
+for res in 64 128 256
+do
+    case ${res} in
+        64)  dt=4.e-5;;
+        128) dt=2.e-5;;
+        256) dt=1.e-5;;
+    esac
+
+    ${EXEC} inputs.${DIM}d.sph ${RUNPARAMS} amr.n_cell="${res} $((2*res))" castro.fixed_dt=${dt} \
+        amr.plot_file=diffuse_implicit_${res}_plt amr.check_file=diffuse_implicit_${res}_chk >& implicit_${res}.out
+
+    err=$(grep "L-inf error against analytic solution" implicit_${res}.out | awk '{print $NF}')
+    runtime=$(grep "^Run time =" implicit_${res}.out | awk '{print $NF}')
+
+    echo "${res}    ${err}    ${runtime}" >> ${ofile}
+done
+
+cat ${ofile}
@@ -0,0 +1,24 @@
+#!/bin/sh
+
+# Time reading the initial model at startup, in the ASCII and binary
+# formats, for a range of MPI rank counts.  Each run also checks that
+# both formats give the same model.  Ranks beyond the number of
+# cores are oversubscribed, which emulates the many ranks of a large
+# run all reading the model at once.
+#
+# usage: ./bench_startup.sh [executable]
+#
+# the rank counts and model size can be set with RANKS and NPTS
+
+EXEC=${1:-$(ls Castro3d.*.MPI.ex | head -1)}
+RANKS=${RANKS:-"16 64 256 1024"}
+NPTS=${NPTS:-100000}
+MPIEXEC=${MPIEXEC:-"mpiexec --oversubscribe"}
+
+python3 make_model.py --npts ${NPTS} model.txt
+python3 ../../../Util/model_parser_cxx/convert_model.py model.txt model.bin
+
+for nranks in ${RANKS}; do
+    echo "ranks = ${nranks}"
+    ${MPIEXEC} -n ${nranks} ${EXEC} inputs problem.model_name=model.txt problem.binary_model_name=model.bin | grep "model read"
+done
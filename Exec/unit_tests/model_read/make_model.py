@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+"""Write a large, uniformly spaced ASCII initial model for the model
+read benchmark.  The profiles are arbitrary, but physical enough to
+initialize the grid with."""
+
+import argparse
+import math
+
+
+def main():
+
+    parser = argparse.ArgumentParser(description="write a synthetic ASCII initial model")
+    parser.add_argument("--npts", type=int, default=100000, help="number of points in the model")
+    parser.add_argument("--r_max", type=float, default=2.e9, help="outer radius of the model")
+    parser.add_argument("outfile", help="name of the model file")
+    args = parser.parse_args()
+
+    species = ["carbon-12", "oxygen-16", "magnesium-24"]
+
+    dr = args.r_max / args.npts
+
+    with open(args.outfile, "w") as f:
+        f.write(f"# npts = {args.npts}\n")
+        f.write(f"# num of variables = {4 + len(species)}\n")
+        for name in ["density", "temperature", "pressure", "velocity"] + species:
+            f.write(f"# {name}\n")
+
+        for i in range(args.npts):
+            r = (i + 0.5) * dr
+            x = r / args.r_max
+
+            dens = 1.e8 * math.exp(-5.0 * x)
+            temp = 1.e9 * (1.0 - 0.9 * x)
+            pres = 1.e25 * math.exp(-6.0 * x)
+            velr = 0.0
+
+            xc = 0.3 + 0.2 * x
+            xo = 0.7 - 0.2 * x
+            xmg = 0.0
+
+            values = [r, dens, temp, pres, velr, xc, xo, xmg]
+            f.write(" ".join(f"{v:24.17g}" for v in values) + "\n")
+
+
+if __name__ == "__main__":
+    main()
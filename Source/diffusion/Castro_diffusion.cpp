@@ -8,6 +8,58 @@ using std::string;
 
 #include <Diffusion.H>
 
+// Fill the edge-centered thermal conductivity from a state that has
+// at least one ghost cell.
+
+static void
+fill_temp_cond_edge_coeffs (const MultiFab& grown_state,
+                             Vector<std::unique_ptr<MultiFab> >& coeffs)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        FArrayBox coeff_cc;
+
+        for (MFIter mfi(grown_state, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+
+            const Box& bx = mfi.tilebox();
+
+            // Create an array for storing cell-centered conductivity data.
+            // It needs to have a ghost zone for the next step.
+
+            const Box& obx = amrex::grow(bx, 1);
+            coeff_cc.resize(obx, 1);
+            Elixir elix_coeff_cc = coeff_cc.elixir();
+            Array4<Real> const coeff_arr = coeff_cc.array();
+
+            Array4<Real const> const U_arr = grown_state.array(mfi);
+
+            fill_temp_cond(obx, U_arr, coeff_arr);
+
+            for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
+
+                const Box& nbx = amrex::surroundingNodes(bx, idir);
+
+                Array4<Real> const edge_coeff_arr = (*coeffs[idir]).array(mfi);
+
+                AMREX_PARALLEL_FOR_3D(nbx, i, j, k,
+                {
+
+                  if (idir == 0) {
+                    edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i-1,j,k));
+                  } else if (idir == 1) {
+                    edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i,j-1,k));
+                  } else {
+                    edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i,j,k-1));
+                  }
+                });
+            }
+        }
+    }
+}
+
 void
 Castro::construct_old_diff_source(MultiFab& source, MultiFab& state_in, Real time, Real dt)
 {
@@ -17,7 +69,44 @@ Castro::construct_old_diff_source(MultiFab& source, MultiFab& state_in, Real tim
 
     MultiFab TempDiffTerm(grids, dmap, 1, 0);
 
-    add_temp_diffusion_to_source(source, state_in, TempDiffTerm, time);
+    if (diffusion::implicit_method > 0) {
+
+        // The predictor is the full implicit update using coefficients
+        // from the old state.  Hold on to it so that the corrector can
+        // time-center without repeating the solve.
+
+        // Without subcycling, the coarsest level solves for all levels
+        // together, and the finer levels use their part of that solve.
+
+        if (level == 0 && parent->finestLevel() > 0 && !parent->subCycle() && !in_retry) {
+            getTempDiffusionImplicitTermComposite(time, dt, state_in);
+        }
+
+        const bool use_composite = implicit_diff_composite &&
+                                   implicit_diff_term_old.boxArray() == grids &&
+                                   implicit_diff_term_old.DistributionMap() == dmap &&
+                                   std::abs(time - implicit_diff_time) <= 1.e-12_rt * amrex::max(1.0_rt, std::abs(time)) &&
+                                   std::abs(dt - implicit_diff_dt) <= 1.e-12_rt * dt;
+
+        if (!use_composite) {
+
+            // A subcycled level, or a level taking a retry with a
+            // smaller step, solves on its own.
+
+            getTempDiffusionImplicitTerm(time, dt, state_in, state_in, TempDiffTerm);
+
+            implicit_diff_term_old.define(grids, dmap, 1, 0);
+            MultiFab::Copy(implicit_diff_term_old, TempDiffTerm, 0, 0, 1, 0);
+
+            implicit_diff_composite = false;
+        }
+
+        MultiFab::Saxpy(source, 1.0, implicit_diff_term_old, 0, UEDEN, 1, 0);
+        MultiFab::Saxpy(source, 1.0, implicit_diff_term_old, 0, UEINT, 1, 0);
+
+    } else {
+        add_temp_diffusion_to_source(source, state_in, TempDiffTerm, time);
+    }
 
     if (verbose > 1)
     {
@@ -46,16 +135,53 @@ Castro::construct_new_diff_source(MultiFab& source, MultiFab& state_old, MultiFa
 
     MultiFab TempDiffTerm(grids, dmap, 1, 0);
 
-    Real mult_factor = 0.5;
+    if (diffusion::implicit_method > 0 && implicit_diff_composite) {
+
+        // The composite solve cannot be repeated with new-state
+        // coefficients here, since the finer levels have not been
+        // advanced yet, so its predictor is the full update and the
+        // corrector adds nothing.
 
-    add_temp_diffusion_to_source(source, state_new, TempDiffTerm, time, mult_factor);
+        implicit_diff_term_old.clear();
+        implicit_diff_composite = false;
 
-    // Time center the source term.
+    } else if (diffusion::implicit_method > 0) {
 
-    mult_factor = -0.5;
-    Real old_time = time - dt;
+        // The corrector repeats the implicit update from the old
+        // temperature, now with coefficients from the new state, and
+        // replaces half of the predictor with it.
 
-    add_temp_diffusion_to_source(source, state_old, TempDiffTerm, old_time, mult_factor);
+        Real old_time = time - dt;
+
+        getTempDiffusionImplicitTerm(old_time, dt, state_old, state_new, TempDiffTerm);
+
+        MultiFab::Saxpy(source, 0.5, TempDiffTerm, 0, UEDEN, 1, 0);
+        MultiFab::Saxpy(source, 0.5, TempDiffTerm, 0, UEINT, 1, 0);
+
+        if (implicit_diff_term_old.boxArray() != grids ||
+            implicit_diff_term_old.DistributionMap() != dmap) {
+            getTempDiffusionImplicitTerm(old_time, dt, state_old, state_old, implicit_diff_term_old);
+        }
+
+        MultiFab::Saxpy(source, -0.5, implicit_diff_term_old, 0, UEDEN, 1, 0);
+        MultiFab::Saxpy(source, -0.5, implicit_diff_term_old, 0, UEINT, 1, 0);
+
+        implicit_diff_term_old.clear();
+
+    } else {
+
+        Real mult_factor = 0.5;
+
+        add_temp_diffusion_to_source(source, state_new, TempDiffTerm, time, mult_factor);
+
+        // Time center the source term.
+
+        mult_factor = -0.5;
+        Real old_time = time - dt;
+
+        add_temp_diffusion_to_source(source, state_old, TempDiffTerm, old_time, mult_factor);
+
+    }
 
     if (verbose > 1)
     {
@@ -115,62 +241,223 @@ Castro::getTempDiffusionTerm (Real time, MultiFab& state_in, MultiFab& TempDiffT
 
        MultiFab::Copy(Temperature, grown_state, UTEMP, 0, 1, 1);
 
+       fill_temp_cond_edge_coeffs(grown_state, coeffs);
+   }
+
+   MultiFab CrseTemp;
+
+   if (level > 0) {
+       // Fill temperature at next coarser level, if it exists.
+       const BoxArray& crse_grids = getLevel(level-1).boxArray();
+       const DistributionMapping& crse_dmap = getLevel(level-1).DistributionMap();
+       CrseTemp.define(crse_grids,crse_dmap,1,1);
+       FillPatch(getLevel(level-1),CrseTemp,1,time,State_Type,UTEMP,1);
+   }
+
+   diffusion->applyop(level, Temperature, CrseTemp, TempDiffTerm, coeffs);
+
+}
+
+
+void
+Castro::fillTempDiffusionImplicitData (Real time, Real coeff_time,
+                                       MultiFab& state_old, MultiFab& state_coeff,
+                                       MultiFab& Temperature, MultiFab& RhoCv,
+                                       Vector<std::unique_ptr<MultiFab> >& coeffs)
+{
+    BL_PROFILE("Castro::fillTempDiffusionImplicitData()");
+
+    coeffs.resize(AMREX_SPACEDIM);
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        coeffs[dir].reset(new MultiFab(getEdgeBoxArray(dir), dmap, 1, 0));
+    }
+
+    Temperature.define(grids, dmap, 1, 1);
+    RhoCv.define(grids, dmap, 1, 0);
+
+    {
+        FillPatchIterator fpi(*this, state_old, 1, time, State_Type, 0, NUM_STATE);
+        MultiFab& grown_state = fpi.get_mf();
+
+        MultiFab::Copy(Temperature, grown_state, UTEMP, 0, 1, 1);
+    }
+
+    {
+        FillPatchIterator fpi(*this, state_coeff, 1, coeff_time, State_Type, 0, NUM_STATE);
+        MultiFab& grown_state = fpi.get_mf();
+
+        fill_temp_cond_edge_coeffs(grown_state, coeffs);
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-       {
-           FArrayBox coeff_cc;
+        for (MFIter mfi(RhoCv, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
 
-           for (MFIter mfi(grown_state, TilingIfNotGPU()); mfi.isValid(); ++mfi)
-           {
+            fill_temp_rhocv(bx, grown_state.array(mfi), RhoCv.array(mfi));
+        }
+    }
+}
 
-               const Box& bx = mfi.tilebox();
 
-               // Create an array for storing cell-centered conductivity data.
-               // It needs to have a ghost zone for the next step.
+void
+Castro::getTempDiffusionImplicitTerm (Real time, Real dt, MultiFab& state_old,
+                                      MultiFab& state_coeff, MultiFab& ImplicitTerm)
+{
+    BL_PROFILE("Castro::getTempDiffusionImplicitTerm()");
 
-               const Box& obx = amrex::grow(bx, 1);
-               coeff_cc.resize(obx, 1);
-               Elixir elix_coeff_cc = coeff_cc.elixir();
-               Array4<Real> const coeff_arr = coeff_cc.array();
+    // We solve
+    //
+    //   rho c_v (T^{n+1} - T^n) / dt = theta L(T^{n+1}) + (1 - theta) L(T^n)
+    //
+    // with L(T) = div(k grad T), theta = 1 for backward Euler and 1/2
+    // for Crank-Nicolson, and return the energy source
+    // rho c_v (T^{n+1} - T^n) / dt.  The coefficients rho c_v and k are
+    // taken from state_coeff, which lives at time + dt if it is not
+    // the old state.
 
-               Array4<Real const> const U_arr = grown_state.array(mfi);
+    const Real theta = (diffusion::implicit_method == 1) ? 1.0_rt : 0.5_rt;
 
-               fill_temp_cond(obx, U_arr, coeff_arr);
+    const Real coeff_time = (&state_coeff == &state_old) ? time : time + dt;
 
-               for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
+    Vector<std::unique_ptr<MultiFab> > coeffs;
+    MultiFab Temperature;
+    MultiFab RhoCv;
 
-                   const Box& nbx = amrex::surroundingNodes(bx, idir);
+    fillTempDiffusionImplicitData(time, coeff_time, state_old, state_coeff,
+                                  Temperature, RhoCv, coeffs);
 
-                   Array4<Real> const edge_coeff_arr = (*coeffs[idir]).array(mfi);
+    // Right-hand side: rho c_v T^n + (1 - theta) dt L(T^n).
 
-                   AMREX_PARALLEL_FOR_3D(nbx, i, j, k,
-                   {
+    MultiFab Rhs(grids, dmap, 1, 0);
 
-                     if (idir == 0) {
-                       edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i-1,j,k));
-                     } else if (idir == 1) {
-                       edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i,j-1,k));
-                     } else {
-                       edge_coeff_arr(i,j,k) = 0.5_rt * (coeff_arr(i,j,k) + coeff_arr(i,j,k-1));
-                     }
-                   });
-               }
-           }
-       }
+    MultiFab::Copy(Rhs, Temperature, 0, 0, 1, 0);
+    MultiFab::Multiply(Rhs, RhoCv, 0, 0, 1, 0);
 
-   }
+    MultiFab CrseTemp;
 
-   MultiFab CrseTemp;
+    if (theta < 1.0_rt) {
+        if (level > 0) {
+            const BoxArray& crse_grids = getLevel(level-1).boxArray();
+            const DistributionMapping& crse_dmap = getLevel(level-1).DistributionMap();
+            CrseTemp.define(crse_grids, crse_dmap, 1, 1);
+            FillPatch(getLevel(level-1), CrseTemp, 1, time, State_Type, UTEMP, 1);
+        }
 
-   if (level > 0) {
-       // Fill temperature at next coarser level, if it exists.
-       const BoxArray& crse_grids = getLevel(level-1).boxArray();
-       const DistributionMapping& crse_dmap = getLevel(level-1).DistributionMap();
-       CrseTemp.define(crse_grids,crse_dmap,1,1);
-       FillPatch(getLevel(level-1),CrseTemp,1,time,State_Type,UTEMP,1);
-   }
+        MultiFab DiffTerm(grids, dmap, 1, 0);
+        diffusion->applyop(level, Temperature, CrseTemp, DiffTerm, coeffs);
 
-   diffusion->applyop(level, Temperature, CrseTemp, TempDiffTerm, coeffs);
+        MultiFab::Saxpy(Rhs, (1.0_rt - theta) * dt, DiffTerm, 0, 0, 1, 0);
+    }
+
+    // The coarse-fine boundary for T^{n+1} comes from the coarse level
+    // at the end of this step, which has already been advanced.
+
+    MultiFab CrseTempNew;
+
+    if (level > 0) {
+        const BoxArray& crse_grids = getLevel(level-1).boxArray();
+        const DistributionMapping& crse_dmap = getLevel(level-1).DistributionMap();
+        CrseTempNew.define(crse_grids, crse_dmap, 1, 1);
+        FillPatch(getLevel(level-1), CrseTempNew, 1, time + dt, State_Type, UTEMP, 1);
+    }
+
+    MultiFab TempNew(grids, dmap, 1, 1);
+    MultiFab::Copy(TempNew, Temperature, 0, 0, 1, 1);
+
+    diffusion->solve_implicit(level, theta * dt, TempNew, CrseTempNew, RhoCv, Rhs, coeffs);
+
+    MultiFab::LinComb(ImplicitTerm, 1.0_rt / dt, TempNew, 0, -1.0_rt / dt, Temperature, 0, 0, 1, 0);
+    MultiFab::Multiply(ImplicitTerm, RhoCv, 0, 0, 1, 0);
+}
 
+
+void
+Castro::getTempDiffusionImplicitTermComposite (Real time, Real dt, MultiFab& state_in)
+{
+    BL_PROFILE("Castro::getTempDiffusionImplicitTermComposite()");
+
+    // Without subcycling, every level takes the same step from the same
+    // time, so the implicit update can be solved for the whole hierarchy
+    // at once.  This is the same solve as in getTempDiffusionImplicitTerm,
+    // with rho c_v and k from the old state, but across all levels, so
+    // that the coarse and fine temperatures are coupled implicitly.  The
+    // source for each level is saved in its implicit_diff_term_old.
+
+    AMREX_ASSERT(level == 0);
+
+    const int nlevs = parent->finestLevel() + 1;
+
+    const Real theta = (diffusion::implicit_method == 1) ? 1.0_rt : 0.5_rt;
+
+    Vector<Vector<std::unique_ptr<MultiFab> > > coeffs(nlevs);
+    Vector<MultiFab> Temperature(nlevs);
+    Vector<MultiFab> RhoCv(nlevs);
+    Vector<MultiFab> Rhs(nlevs);
+    Vector<MultiFab> TempNew(nlevs);
+
+    Vector<Array<MultiFab const*, AMREX_SPACEDIM> > coeff_ptrs(nlevs);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+
+        Castro& c_lev = getLevel(lev);
+
+        // The finer levels have not started their step yet, so their
+        // data at this time is in the new state.  FillPatch picks the
+        // right time level; the MultiFab here only supplies the grids.
+
+        MultiFab& S = (lev == level) ? state_in : c_lev.get_new_data(State_Type);
+
+        c_lev.fillTempDiffusionImplicitData(time, time, S, S,
+                                            Temperature[lev], RhoCv[lev], coeffs[lev]);
+
+        coeff_ptrs[lev] = {AMREX_D_DECL(coeffs[lev][0].get(),
+                                        coeffs[lev][1].get(),
+                                        coeffs[lev][2].get())};
+
+        // Right-hand side: rho c_v T^n + (1 - theta) dt L(T^n).
+
+        Rhs[lev].define(c_lev.boxArray(), c_lev.DistributionMap(), 1, 0);
+
+        MultiFab::Copy(Rhs[lev], Temperature[lev], 0, 0, 1, 0);
+        MultiFab::Multiply(Rhs[lev], RhoCv[lev], 0, 0, 1, 0);
+
+        TempNew[lev].define(c_lev.boxArray(), c_lev.DistributionMap(), 1, 1);
+        MultiFab::Copy(TempNew[lev], Temperature[lev], 0, 0, 1, 1);
+    }
+
+    if (theta < 1.0_rt) {
+        Vector<MultiFab> DiffTerm(nlevs);
+        for (int lev = 0; lev < nlevs; ++lev) {
+            DiffTerm[lev].define(Rhs[lev].boxArray(), Rhs[lev].DistributionMap(), 1, 0);
+        }
+
+        diffusion->applyop_composite(GetVecOfPtrs(Temperature), GetVecOfPtrs(DiffTerm), coeff_ptrs);
+
+        for (int lev = 0; lev < nlevs; ++lev) {
+            MultiFab::Saxpy(Rhs[lev], (1.0_rt - theta) * dt, DiffTerm[lev], 0, 0, 1, 0);
+        }
+    }
+
+    diffusion->solve_implicit_composite(theta * dt, GetVecOfPtrs(TempNew),
+                                        GetVecOfConstPtrs(RhoCv), GetVecOfConstPtrs(Rhs),
+                                        coeff_ptrs);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+
+        Castro& c_lev = getLevel(lev);
+
+        MultiFab& term = c_lev.implicit_diff_term_old;
+
+        term.define(c_lev.boxArray(), c_lev.DistributionMap(), 1, 0);
+
+        MultiFab::LinComb(term, 1.0_rt / dt, TempNew[lev], 0, -1.0_rt / dt, Temperature[lev], 0, 0, 1, 0);
+        MultiFab::Multiply(term, RhoCv[lev], 0, 0, 1, 0);
+
+        c_lev.implicit_diff_composite = true;
+        c_lev.implicit_diff_time = time;
+        c_lev.implicit_diff_dt = dt;
+    }
 }
+
@@ -167,3 +167,165 @@ Diffusion::applyop_mlmg (int level, MultiFab& Temperature,
     mlmg.setVerbose(verbose);
     mlmg.apply({&DiffTerm}, {&Temperature});
 }
+
+void
+Diffusion::solve_implicit (int level, Real theta_dt,
+                           MultiFab& Temperature, MultiFab& CrseTemp,
+                           const MultiFab& acoef, const MultiFab& rhs,
+                           Vector<std::unique_ptr<MultiFab> >& temp_cond_coef)
+{
+    BL_PROFILE("Diffusion::solve_implicit()");
+
+    if (verbose && ParallelDescriptor::IOProcessor()) {
+        std::cout << "   " << '\n';
+        std::cout << "... implicit thermal diffusion solve at level " << level << '\n';
+    }
+
+    const Geometry& geom = parent->Geom(level);
+    const BoxArray& ba = Temperature.boxArray();
+    const DistributionMapping& dm = Temperature.DistributionMap();
+
+    // Unlike the explicit operator, here we want the full multigrid
+    // hierarchy below this level to converge the solve.
+
+    LPInfo info;
+    info.setMetricTerm(true);
+    info.setAgglomeration(0);
+    info.setConsolidation(0);
+
+    MLABecLaplacian mlabec({geom}, {ba}, {dm}, info);
+    mlabec.setMaxOrder(diffusion::mlmg_maxorder);
+
+    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
+
+    if (level > 0) {
+        const auto& rr = parent->refRatio(level-1);
+        mlabec.setCoarseFineBC(&CrseTemp, rr[0]);
+    }
+    mlabec.setLevelBC(0, &Temperature);
+
+    mlabec.setScalars(1.0, theta_dt);
+    mlabec.setACoeffs(0, acoef);
+    mlabec.setBCoeffs(0, Array<MultiFab const*, AMREX_SPACEDIM>{AMREX_D_DECL(temp_cond_coef[0].get(),
+                                                                             temp_cond_coef[1].get(),
+                                                                             temp_cond_coef[2].get())});
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.setMaxIter(diffusion::implicit_maxiter);
+
+    Real final_resnorm = mlmg.solve({&Temperature}, {&rhs},
+                                    diffusion::implicit_reltol, diffusion::implicit_abstol);
+
+    if (verbose && ParallelDescriptor::IOProcessor()) {
+        std::cout << "... implicit diffusion solve converged in " << mlmg.getNumIters()
+                  << " iterations, final residual " << final_resnorm << '\n';
+    }
+}
+
+void
+Diffusion::applyop_composite (const Vector<MultiFab*>& Temperature,
+                              const Vector<MultiFab*>& DiffTerm,
+                              const Vector<Array<MultiFab const*, AMREX_SPACEDIM> >& temp_cond_coef)
+{
+    BL_PROFILE("Diffusion::applyop_composite()");
+
+    const int nlevs = Temperature.size();
+
+    if (verbose && ParallelDescriptor::IOProcessor()) {
+        std::cout << "   " << '\n';
+        std::cout << "... compute composite diffusive term on levels 0 to " << nlevs-1 << '\n';
+    }
+
+    Vector<Geometry> geom(nlevs);
+    Vector<BoxArray> ba(nlevs);
+    Vector<DistributionMapping> dm(nlevs);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+        geom[lev] = parent->Geom(lev);
+        ba[lev] = Temperature[lev]->boxArray();
+        dm[lev] = Temperature[lev]->DistributionMap();
+    }
+
+    LPInfo info;
+    info.setMetricTerm(true);
+    info.setMaxCoarseningLevel(0);
+    info.setAgglomeration(0);
+    info.setConsolidation(0);
+
+    MLABecLaplacian mlabec(geom, ba, dm, info);
+    mlabec.setMaxOrder(diffusion::mlmg_maxorder);
+
+    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
+
+    mlabec.setScalars(0.0, -1.0);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+        mlabec.setLevelBC(lev, Temperature[lev]);
+        mlabec.setBCoeffs(lev, temp_cond_coef[lev]);
+    }
+
+    // MLMG::apply refluxes the coarse levels, so the result is the
+    // divergence of the composite flux.
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.apply(DiffTerm, Temperature);
+}
+
+void
+Diffusion::solve_implicit_composite (Real theta_dt,
+                                     const Vector<MultiFab*>& Temperature,
+                                     const Vector<MultiFab const*>& acoef,
+                                     const Vector<MultiFab const*>& rhs,
+                                     const Vector<Array<MultiFab const*, AMREX_SPACEDIM> >& temp_cond_coef)
+{
+    BL_PROFILE("Diffusion::solve_implicit_composite()");
+
+    const int nlevs = Temperature.size();
+
+    if (verbose && ParallelDescriptor::IOProcessor()) {
+        std::cout << "   " << '\n';
+        std::cout << "... composite implicit thermal diffusion solve on levels 0 to " << nlevs-1 << '\n';
+    }
+
+    Vector<Geometry> geom(nlevs);
+    Vector<BoxArray> ba(nlevs);
+    Vector<DistributionMapping> dm(nlevs);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+        geom[lev] = parent->Geom(lev);
+        ba[lev] = Temperature[lev]->boxArray();
+        dm[lev] = Temperature[lev]->DistributionMap();
+    }
+
+    LPInfo info;
+    info.setMetricTerm(true);
+    info.setAgglomeration(0);
+    info.setConsolidation(0);
+
+    MLABecLaplacian mlabec(geom, ba, dm, info);
+    mlabec.setMaxOrder(diffusion::mlmg_maxorder);
+
+    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
+
+    mlabec.setScalars(1.0, theta_dt);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+        mlabec.setLevelBC(lev, Temperature[lev]);
+        mlabec.setACoeffs(lev, *acoef[lev]);
+        mlabec.setBCoeffs(lev, temp_cond_coef[lev]);
+    }
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.setMaxIter(diffusion::implicit_maxiter);
+
+    Real final_resnorm = mlmg.solve(Temperature, rhs,
+                                    diffusion::implicit_reltol, diffusion::implicit_abstol);
+
+    if (verbose && ParallelDescriptor::IOProcessor()) {
+        std::cout << "... composite implicit diffusion solve converged in " << mlmg.getNumIters()
+                  << " iterations, final residual " << final_resnorm << '\n';
+    }
+}
@@ -20,6 +20,8 @@
 #include <AMReX_TagBox.H>
 #include <AMReX_FillPatchUtil.H>
 #include <AMReX_ParmParse.H>
+#include <AMReX_GpuContainers.H>
+#include <reflux_faces.H>
 #ifdef MICROPHYSICS_FORT
 #include <extern_parameters_F.H>
 #endif
@@ -35,6 +37,7 @@
 
 #ifdef GRAVITY
 #include <Gravity.H>
+#include <Castro_bc_fill_nd.H>
 #endif
 
 #ifdef DIFFUSION
@@ -63,6 +66,7 @@
 #include <problem_tagging.H>
 
 #include <ambient.H>
+#include <eos_table.H>
 
 using namespace amrex;
 
@@ -85,6 +89,8 @@ Vector<std::string> Castro::source_names;
 
 Vector<AMRErrorTag> Castro::error_tags;
 
+Vector<Castro::TaggingCriterion> Castro::tagging_criteria;
+
 Vector<std::unique_ptr<std::fstream>> Castro::data_logs;
 Vector<std::unique_ptr<std::fstream>> Castro::problem_data_logs;
 
@@ -201,6 +207,8 @@ Castro::variableCleanUp ()
 #endif
 
     // C++ cleaning
+    eos_table::finalize();
+
     eos_finalize();
 
 }
@@ -328,6 +336,47 @@ Castro::read_params ()
 #endif
 
 #ifdef REACTIONS
+    if (burn_load_balance == 1) {
+        int loadbalance_with_workestimates = 0;
+        ParmParse ppa("amr");
+        ppa.query("loadbalance_with_workestimates", loadbalance_with_workestimates);
+
+        if (loadbalance_with_workestimates == 0 && burn_load_balance_int <= 0) {
+            amrex::Warning("castro.burn_load_balance = 1 has no effect unless amr.loadbalance_with_workestimates = 1 or castro.burn_load_balance_int > 0");
+        }
+
+        // A redistribution copies all of the state data, so do not do
+        // it more often than AMReX rebuilds the grids: the level 0
+        // regrid interval, or amr.loadbalance_level0_int (the level 0
+        // load balancing interval) for a single-level run. In any
+        // case it may not happen every coarse timestep.
+
+        if (burn_load_balance_int > 0) {
+            int max_level = 0;
+            ppa.query("max_level", max_level);
+
+            int min_int = 2;
+            if (max_level > 0) {
+                Vector<int> regrid_int;
+                ppa.queryarr("regrid_int", regrid_int);
+                if (regrid_int.size() > 0) {
+                    min_int = amrex::max(min_int, regrid_int[0]);
+                }
+            }
+            else {
+                int loadbalance_level0_int = 2;
+                ppa.query("loadbalance_level0_int", loadbalance_level0_int);
+                min_int = amrex::max(min_int, loadbalance_level0_int);
+            }
+
+            if (burn_load_balance_int < min_int) {
+                amrex::Print() << "castro.burn_load_balance_int = " << burn_load_balance_int
+                               << " is less than the regrid/load balance interval; using " << min_int << std::endl;
+                burn_load_balance_int = min_int;
+            }
+        }
+    }
+
 #ifdef SIMPLIFIED_SDC
     if (jacobian == 1) {
       amrex::Abort("Simplified SDC requires the numerical Jacobian now (jacobian = 2)");
@@ -376,6 +425,28 @@ Castro::read_params ()
     }
 #endif
 
+#ifdef DIFFUSION
+    if (diffusion::implicit_method > 0 && time_integration_method != CornerTransportUpwind) {
+        amrex::Error("Implicit thermal diffusion is only implemented for the CTU integrator.");
+    }
+
+    if (diffusion::implicit_method < 0 || diffusion::implicit_method > 2) {
+        amrex::Error("diffusion.implicit_method must be 0, 1, or 2.");
+    }
+#endif
+
+    if (retry_local == 1) {
+        if (time_integration_method != CornerTransportUpwind) {
+            amrex::Error("castro.retry_local is only implemented for the CTU integrator.");
+        }
+#if defined(MHD) || defined(RADIATION)
+        amrex::Error("castro.retry_local is not supported with MHD or radiation.");
+#endif
+        if (retry_local_halo < 0) {
+            amrex::Error("castro.retry_local_halo must be non-negative.");
+        }
+    }
+
 #ifndef AMREX_USE_GPU
 
 #ifdef RADIATION
@@ -568,53 +639,57 @@ Castro::read_params ()
 
         AMRErrorTagInfo info;
 
+        TaggingCriterion criterion;
+        criterion.min_time = std::numeric_limits<Real>::lowest();
+        criterion.max_time = std::numeric_limits<Real>::max();
+        criterion.max_level = 1000;
+
         if (ppr.countval("start_time") > 0) {
             Real min_time;
             ppr.get("start_time", min_time);
             info.SetMinTime(min_time);
+            criterion.min_time = min_time;
         }
         if (ppr.countval("end_time") > 0) {
             Real max_time;
             ppr.get("end_time", max_time);
             info.SetMaxTime(max_time);
+            criterion.max_time = max_time;
         }
         if (ppr.countval("max_level") > 0) {
             int max_level;
             ppr.get("max_level", max_level);
             info.SetMaxLevel(max_level);
+            criterion.max_level = max_level;
         }
 
-        if (int nval = ppr.countval("value_greater")) {
-            Vector<Real> value;
-            ppr.getarr("value_greater", value, 0, nval);
-            std::string field;
-            ppr.get("field_name", field);
-            error_tags.push_back(AMRErrorTag(value, AMRErrorTag::GREATER, field, info));
+        std::string test_name;
+
+        if (ppr.countval("value_greater")) {
+            test_name = "value_greater";
+            criterion.test = AMRErrorTag::GREATER;
         }
-        else if (int nval = ppr.countval("value_less")) {
-            Vector<Real> value;
-            ppr.getarr("value_less", value, 0, nval);
-            std::string field;
-            ppr.get("field_name", field);
-            error_tags.push_back(AMRErrorTag(value, AMRErrorTag::LESS, field, info));
+        else if (ppr.countval("value_less")) {
+            test_name = "value_less";
+            criterion.test = AMRErrorTag::LESS;
         }
-        else if (int nval = ppr.countval("gradient")) {
-            Vector<Real> value;
-            ppr.getarr("gradient", value, 0, nval);
-            std::string field;
-            ppr.get("field_name", field);
-            error_tags.push_back(AMRErrorTag(value, AMRErrorTag::GRAD, field, info));
+        else if (ppr.countval("gradient")) {
+            test_name = "gradient";
+            criterion.test = AMRErrorTag::GRAD;
         }
-        else if (int nval = ppr.countval("relative_gradient")) {
-            Vector<Real> value;
-            ppr.getarr("relative_gradient", value, 0, nval);
-            std::string field;
-            ppr.get("field_name", field);
-            error_tags.push_back(AMRErrorTag(value, AMRErrorTag::RELGRAD, field, info));
+        else if (ppr.countval("relative_gradient")) {
+            test_name = "relative_gradient";
+            criterion.test = AMRErrorTag::RELGRAD;
         }
         else {
             amrex::Abort("Unrecognized refinement indicator for " + refinement_indicators[i]);
         }
+
+        ppr.getarr(test_name.c_str(), criterion.value, 0, ppr.countval(test_name.c_str()));
+        ppr.get("field_name", criterion.field);
+
+        error_tags.push_back(AMRErrorTag(criterion.value, criterion.test, criterion.field, info));
+        tagging_criteria.push_back(criterion);
     }
 
 }
@@ -990,6 +1065,10 @@ Castro::initData ()
 #ifdef REACTIONS
     MultiFab &React_new = get_new_data(Reactions_Type);
     React_new.setVal(0.);
+
+    // Every zone does at least one unit of work.
+    MultiFab& Work_new = get_new_data(Work_Estimate_Type);
+    Work_new.setVal(1.0);
 #endif
 
 #ifdef SIMPLIFIED_SDC
@@ -1372,8 +1451,6 @@ Castro::initData ()
 #ifdef GRAVITY
 #if (AMREX_SPACEDIM > 1)
     if ( (level == 0) && (spherical_star == 1) ) {
-       const int nc = S_new.nComp();
-       const int n1d = get_numpts();
        int is_new = 1;
        make_radial_data(is_new);
     }
@@ -1570,10 +1647,17 @@ Castro::estTimeStep ()
 
     Real estdt_diffusion = max_dt / cfl;
 
-    if (diffuse_temp)
+    // The implicit diffusion update is unconditionally stable, so the
+    // limiter is only kept there if it was asked for.
+
+    if (diffuse_temp && diffusion::implicit_method == 0)
     {
       estdt_diffusion = estdt_temp_diffusion();
     }
+    else if (diffuse_temp && diffusion::implicit_dt_limiter_factor > 0.0)
+    {
+      estdt_diffusion = diffusion::implicit_dt_limiter_factor * estdt_temp_diffusion();
+    }
 
     ParallelDescriptor::ReduceRealMin(estdt_diffusion);
     estdt_diffusion *= cfl;
@@ -1929,6 +2013,19 @@ Castro::post_timestep (int iteration_local)
 
     problem_post_timestep();
 
+    // The problem may have changed the state without recomputing the
+    // temperature, so don't trust the saved sound speed.
+
+    sound_speed_valid = false;
+
+#endif
+
+#ifdef REACTIONS
+    // Fold the burn cost of this step into the work estimate used for load balancing.
+
+    if (burn_load_balance == 1) {
+        update_burn_work_estimate();
+    }
 #endif
 
     if (level == 0)
@@ -1968,6 +2065,10 @@ Castro::post_timestep (int iteration_local)
         if (moving_center) {
           write_center();
         }
+
+        if (do_grav) {
+          gravity->report_solve_stats();
+        }
 #endif
     }
 
@@ -2099,6 +2200,20 @@ Castro::postCoarseTimeStep (Real cumtime)
 #ifdef GRAVITY
     if (do_grav)
         gravity->set_mass_offset(cumtime, 0);
+
+    if (verbose > 0) {
+        hse_fill_cache_report();
+    }
+#endif
+
+#ifdef REACTIONS
+    // Redistribute the grids according to the burn cost. This replaces
+    // the level objects, including this one, so it must come last.
+
+    if (burn_load_balance == 1 && burn_load_balance_int > 0 &&
+        parent->levelSteps(0) % burn_load_balance_int == 0) {
+        burn_load_balance_levels(*parent);
+    }
 #endif
 }
 
@@ -2111,6 +2226,23 @@ Castro::post_regrid (int lbase,
 
     fine_mask.clear();
 
+#ifdef REACTIONS
+    if (burn_load_balance == 1 && verbose) {
+
+        // Compare the distribution we got against the default
+        // (space-filling curve) distribution of these boxes.
+
+        const Vector<Real> cost = burn_work_per_box();
+
+        const DistributionMapping dm_default(grids);
+
+        amrex::Print() << "... burn load balancing on level " << level
+                       << ": imbalance with default distribution = " << burn_load_imbalance(cost, dm_default)
+                       << ", with current distribution = " << burn_load_imbalance(cost, dmap) << std::endl;
+
+    }
+#endif
+
 #ifdef AMREX_PARTICLES
     if (TracerPC && level == lbase) {
         TracerPC->Redistribute(lbase);
@@ -2581,6 +2713,10 @@ Castro::reflux(int crse_level, int fine_level)
 
     FluxRegister* reg;
 
+    // Size of the largest set of gathered coarse-fine face data, for the verbose report.
+
+    Long reflux_bytes = 0;
+
     for (int lev = fine_level; lev > crse_level; --lev) {
 
         reg = &getLevel(lev).flux_reg;
@@ -2589,56 +2725,99 @@ Castro::reflux(int crse_level, int fine_level)
 
         MultiFab& crse_state = crse_lev.get_new_data(State_Type);
 
+#ifdef GRAVITY
+        int ilev = lev - crse_level - 1;
+
+        const bool do_grav_sync = do_grav && gravity->get_gravity_type() == "PoissonGrav" && gravity->NoSync() == 0;
+#endif
+
         // Clear out the data that's not on coarse-fine boundaries so that this register only
         // modifies the fluxes on coarse-fine interfaces.
 
         reg->ClearInternalBorders(crse_lev.geom);
 
-        // Trigger the actual reflux on the coarse level now.
+        if (sparse_reflux) {
 
-        reg->Reflux(crse_state, crse_lev.volume, 1.0, 0, 0, NUM_STATE, crse_lev.geom);
+            // Gather the register data onto the coarse grids once, keeping only the
+            // coarse-fine faces, and apply it to the state, the density change for
+            // the gravity sync, and the coarse fluxes from there.
 
-        // Store the density change, for the gravity sync.
+            RefluxFaces faces;
+            gather_reflux_faces(*reg, crse_state, crse_lev.geom, NUM_STATE, faces);
 
-#ifdef GRAVITY
-        int ilev = lev - crse_level - 1;
+            reflux_bytes = std::max(reflux_bytes, reflux_faces_bytes(faces));
 
-        if (do_grav && gravity->get_gravity_type() == "PoissonGrav" && gravity->NoSync() == 0) {
-            reg->Reflux(*drho[ilev], crse_lev.volume, 1.0, 0, URHO, 1, crse_lev.geom);
-            amrex::average_down(*drho[ilev + 1], *drho[ilev], 0, 1, getLevel(lev).crse_ratio);
-        }
+            apply_reflux_faces(faces, crse_state, 0, 0, NUM_STATE, &crse_lev.volume, 0.0);
+
+#ifdef GRAVITY
+            if (do_grav_sync) {
+                apply_reflux_faces(faces, *drho[ilev], URHO, 0, 1, &crse_lev.volume, 0.0);
+                amrex::average_down(*drho[ilev + 1], *drho[ilev], 0, 1, getLevel(lev).crse_ratio);
+            }
 #endif
 
-        // Also update the coarse fluxes MultiFabs using the reflux data. This should only make
-        // a difference if we re-evaluate the source terms later.
+            if (update_sources_after_reflux) {
 
-        Vector<std::unique_ptr<MultiFab> > temp_fluxes(3);
+                add_reflux_faces_to_fluxes(faces, {AMREX_D_DECL(crse_lev.fluxes[0].get(),
+                                                                crse_lev.fluxes[1].get(),
+                                                                crse_lev.fluxes[2].get())}, NUM_STATE);
 
-        if (update_sources_after_reflux) {
+                // See below for why the mass fluxes are a copy rather than an add.
+
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    MultiFab::Copy(*crse_lev.mass_fluxes[i], *crse_lev.fluxes[i], URHO, 0, 1, 0);
+                }
 
-            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                temp_fluxes[i].reset(new MultiFab(crse_lev.fluxes[i]->boxArray(),
-                                                  crse_lev.fluxes[i]->DistributionMap(),
-                                                  crse_lev.fluxes[i]->nComp(), crse_lev.fluxes[i]->nGrow()));
-                temp_fluxes[i]->setVal(0.0);
             }
-            for (OrientationIter fi; fi; ++fi) {
-                const FabSet& fs = (*reg)[fi()];
-                int idir = fi().coordDir();
-                fs.copyTo(*temp_fluxes[idir], 0, 0, 0, temp_fluxes[idir]->nComp());
+
+        }
+        else {
+
+            // Trigger the actual reflux on the coarse level now.
+
+            reg->Reflux(crse_state, crse_lev.volume, 1.0, 0, 0, NUM_STATE, crse_lev.geom);
+
+            // Store the density change, for the gravity sync.
+
+#ifdef GRAVITY
+            if (do_grav_sync) {
+                reg->Reflux(*drho[ilev], crse_lev.volume, 1.0, 0, URHO, 1, crse_lev.geom);
+                amrex::average_down(*drho[ilev + 1], *drho[ilev], 0, 1, getLevel(lev).crse_ratio);
             }
-            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                MultiFab::Add(*crse_lev.fluxes[i], *temp_fluxes[i], 0, 0, crse_lev.fluxes[i]->nComp(), 0);
+#endif
+
+            // Also update the coarse fluxes MultiFabs using the reflux data. This should only make
+            // a difference if we re-evaluate the source terms later.
+
+            Vector<std::unique_ptr<MultiFab> > temp_fluxes(3);
+
+            if (update_sources_after_reflux) {
+
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    temp_fluxes[i].reset(new MultiFab(crse_lev.fluxes[i]->boxArray(),
+                                                      crse_lev.fluxes[i]->DistributionMap(),
+                                                      crse_lev.fluxes[i]->nComp(), crse_lev.fluxes[i]->nGrow()));
+                    temp_fluxes[i]->setVal(0.0);
+                }
+                for (OrientationIter fi; fi; ++fi) {
+                    const FabSet& fs = (*reg)[fi()];
+                    int idir = fi().coordDir();
+                    fs.copyTo(*temp_fluxes[idir], 0, 0, 0, temp_fluxes[idir]->nComp());
+                }
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    MultiFab::Add(*crse_lev.fluxes[i], *temp_fluxes[i], 0, 0, crse_lev.fluxes[i]->nComp(), 0);
+
+                    // The gravity and rotation source terms depend on the mass fluxes.
+                    // These should be the same as the URHO component of the fluxes.
+                    // This update must be a copy from the fluxes rather than an add
+                    // from the flux register because the mass fluxes only represent
+                    // the last subcycle of the previous timestep.
 
-                // The gravity and rotation source terms depend on the mass fluxes.
-                // These should be the same as the URHO component of the fluxes.
-                // This update must be a copy from the fluxes rather than an add
-                // from the flux register because the mass fluxes only represent
-                // the last subcycle of the previous timestep.
+                    MultiFab::Copy(*crse_lev.mass_fluxes[i], *crse_lev.fluxes[i], URHO, 0, 1, 0);
 
-                MultiFab::Copy(*crse_lev.mass_fluxes[i], *crse_lev.fluxes[i], URHO, 0, 1, 0);
+                    temp_fluxes[i].reset();
+                }
 
-                temp_fluxes[i].reset();
             }
 
         }
@@ -2652,31 +2831,54 @@ Castro::reflux(int crse_level, int fine_level)
 
             reg = &getLevel(lev).pres_reg;
 
-            MultiFab dr(crse_lev.grids, crse_lev.dmap, 1, 0);
-            dr.setVal(crse_lev.geom.CellSize(0));
-
             reg->ClearInternalBorders(crse_lev.geom);
 
-            reg->Reflux(crse_state, dr, 1.0, 0, UMX, 1, crse_lev.geom);
+            if (sparse_reflux) {
 
-            if (update_sources_after_reflux) {
+                // The pressure register is divided by the (constant) radial zone
+                // width rather than the zone volume.
 
-                temp_fluxes[0].reset(new MultiFab(crse_lev.P_radial.boxArray(),
-                                                  crse_lev.P_radial.DistributionMap(),
-                                                  crse_lev.P_radial.nComp(), crse_lev.P_radial.nGrow()));
-                temp_fluxes[0]->setVal(0.0);
+                RefluxFaces faces;
+                gather_reflux_faces(*reg, crse_state, crse_lev.geom, 1, faces);
 
-                for (OrientationIter fi; fi; ++fi)
-                {
-                    const FabSet& fs = (*reg)[fi()];
-                    int idir = fi().coordDir();
-                    if (idir == 0) {
-                        fs.copyTo(*temp_fluxes[idir], 0, 0, 0, temp_fluxes[idir]->nComp());
-                    }
+                reflux_bytes = std::max(reflux_bytes, reflux_faces_bytes(faces));
+
+                apply_reflux_faces(faces, crse_state, 0, UMX, 1, nullptr, crse_lev.geom.CellSize(0));
+
+                if (update_sources_after_reflux) {
+                    add_reflux_faces_to_fluxes(faces, {AMREX_D_DECL(&crse_lev.P_radial, nullptr, nullptr)}, 1);
                 }
 
-                MultiFab::Add(crse_lev.P_radial, *temp_fluxes[0], 0, 0, crse_lev.P_radial.nComp(), 0);
-                temp_fluxes[0].reset();
+            }
+            else {
+
+                MultiFab dr(crse_lev.grids, crse_lev.dmap, 1, 0);
+                dr.setVal(crse_lev.geom.CellSize(0));
+
+                reg->Reflux(crse_state, dr, 1.0, 0, UMX, 1, crse_lev.geom);
+
+                if (update_sources_after_reflux) {
+
+                    std::unique_ptr<MultiFab> temp_flux;
+
+                    temp_flux.reset(new MultiFab(crse_lev.P_radial.boxArray(),
+                                                 crse_lev.P_radial.DistributionMap(),
+                                                 crse_lev.P_radial.nComp(), crse_lev.P_radial.nGrow()));
+                    temp_flux->setVal(0.0);
+
+                    for (OrientationIter fi; fi; ++fi)
+                    {
+                        const FabSet& fs = (*reg)[fi()];
+                        int idir = fi().coordDir();
+                        if (idir == 0) {
+                            fs.copyTo(*temp_flux, 0, 0, 0, temp_flux->nComp());
+                        }
+                    }
+
+                    MultiFab::Add(crse_lev.P_radial, *temp_flux, 0, 0, crse_lev.P_radial.nComp(), 0);
+                    temp_flux.reset();
+
+                }
 
             }
 
@@ -2695,24 +2897,48 @@ Castro::reflux(int crse_level, int fine_level)
 
             reg->ClearInternalBorders(crse_lev.geom);
 
-            reg->Reflux(crse_lev.get_new_data(Rad_Type), crse_lev.volume, 1.0, 0, 0, Radiation::nGroups, crse_lev.geom);
+            MultiFab& crse_rad = crse_lev.get_new_data(Rad_Type);
 
-            if (update_sources_after_reflux) {
+            if (sparse_reflux) {
 
-                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                    temp_fluxes[i].reset(new MultiFab(crse_lev.rad_fluxes[i]->boxArray(),
-                                                      crse_lev.rad_fluxes[i]->DistributionMap(),
-                                                      crse_lev.rad_fluxes[i]->nComp(), crse_lev.rad_fluxes[i]->nGrow()));
-                    temp_fluxes[i]->setVal(0.0);
-                }
-                for (OrientationIter fi; fi; ++fi) {
-                    const FabSet& fs = (*reg)[fi()];
-                    int idir = fi().coordDir();
-                    fs.copyTo(*temp_fluxes[idir], 0, 0, 0, temp_fluxes[idir]->nComp());
+                RefluxFaces faces;
+                gather_reflux_faces(*reg, crse_rad, crse_lev.geom, Radiation::nGroups, faces);
+
+                reflux_bytes = std::max(reflux_bytes, reflux_faces_bytes(faces));
+
+                apply_reflux_faces(faces, crse_rad, 0, 0, Radiation::nGroups, &crse_lev.volume, 0.0);
+
+                if (update_sources_after_reflux) {
+                    add_reflux_faces_to_fluxes(faces, {AMREX_D_DECL(crse_lev.rad_fluxes[0].get(),
+                                                                    crse_lev.rad_fluxes[1].get(),
+                                                                    crse_lev.rad_fluxes[2].get())}, Radiation::nGroups);
                 }
-                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                    MultiFab::Add(*crse_lev.rad_fluxes[i], *temp_fluxes[i], 0, 0, crse_lev.rad_fluxes[i]->nComp(), 0);
-                    temp_fluxes[i].reset();
+
+            }
+            else {
+
+                reg->Reflux(crse_rad, crse_lev.volume, 1.0, 0, 0, Radiation::nGroups, crse_lev.geom);
+
+                if (update_sources_after_reflux) {
+
+                    Vector<std::unique_ptr<MultiFab> > temp_fluxes(3);
+
+                    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                        temp_fluxes[i].reset(new MultiFab(crse_lev.rad_fluxes[i]->boxArray(),
+                                                          crse_lev.rad_fluxes[i]->DistributionMap(),
+                                                          crse_lev.rad_fluxes[i]->nComp(), crse_lev.rad_fluxes[i]->nGrow()));
+                        temp_fluxes[i]->setVal(0.0);
+                    }
+                    for (OrientationIter fi; fi; ++fi) {
+                        const FabSet& fs = (*reg)[fi()];
+                        int idir = fi().coordDir();
+                        fs.copyTo(*temp_fluxes[idir], 0, 0, 0, temp_fluxes[idir]->nComp());
+                    }
+                    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                        MultiFab::Add(*crse_lev.rad_fluxes[i], *temp_fluxes[i], 0, 0, crse_lev.rad_fluxes[i]->nComp(), 0);
+                        temp_fluxes[i].reset();
+                    }
+
                 }
 
             }
@@ -2724,7 +2950,7 @@ Castro::reflux(int crse_level, int fine_level)
 #endif
 
 #ifdef GRAVITY
-        if (do_grav && gravity->get_gravity_type() == "PoissonGrav" && gravity->NoSync() == 0)  {
+        if (do_grav_sync)  {
 
             reg = &getLevel(lev).phi_reg;
             Castro& fine_lev = getLevel(lev);
@@ -2740,7 +2966,14 @@ Castro::reflux(int crse_level, int fine_level)
                 reg->FineAdd(*(gravity->get_grad_phi_curr(lev)[i]), fine_lev.area[i], i, 0, 0, 1, 1.0);
             }
 
-            reg->Reflux(*dphi[ilev], crse_lev.volume, 1.0, 0, 0, 1, crse_lev.geom);
+            if (sparse_reflux) {
+                RefluxFaces faces;
+                gather_reflux_faces(*reg, *dphi[ilev], crse_lev.geom, 1, faces);
+                apply_reflux_faces(faces, *dphi[ilev], 0, 0, 1, &crse_lev.volume, 0.0);
+            }
+            else {
+                reg->Reflux(*dphi[ilev], crse_lev.volume, 1.0, 0, 0, 1, crse_lev.geom);
+            }
 
             amrex::average_down(*dphi[ilev + 1], *dphi[ilev], 0, 1, getLevel(lev).crse_ratio);
 
@@ -2876,8 +3109,13 @@ Castro::reflux(int crse_level, int fine_level)
         Lazy::QueueReduction( [=] () mutable {
 #endif
         ParallelDescriptor::ReduceRealMax(end,IOProc);
+        ParallelDescriptor::ReduceLongMax(reflux_bytes,IOProc);
         if (ParallelDescriptor::IOProcessor()) {
           std::cout << "Castro::reflux() at level " << level << " : time = " << end << std::endl;
+          if (sparse_reflux) {
+            std::cout << "Castro::reflux() at level " << level << " : coarse-fine face data = "
+                      << reflux_bytes << " bytes" << std::endl;
+          }
         }
 #ifdef BL_LAZY
         });
@@ -3137,6 +3375,8 @@ Castro::errorEst (TagBoxArray& tags,
 {
     BL_PROFILE("Castro::errorEst()");
 
+    const Real strt = ParallelDescriptor::second();
+
     Real ltime = time;
 
     // If we are forcing a post-timestep regrid,
@@ -3147,24 +3387,250 @@ Castro::errorEst (TagBoxArray& tags,
       ltime = get_state_data(State_Type).curTime();
     }
 
-    // Apply each of the tagging criteria defined in the inputs.
+    if (fused_tagging == 1) {
+
+        // Apply the tagging criteria defined in the inputs and the
+        // user-specified tags together, in one pass over the grids.
+
+        apply_fused_tags(tags, time);
 
-    for (int j = 0; j < error_tags.size(); j++) {
-        std::unique_ptr<MultiFab> mf;
-        if (error_tags[j].Field() != std::string()) {
-            mf = derive(error_tags[j].Field(), time, error_tags[j].NGrow());
-        }
-        error_tags[j](tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, level, geom);
     }
+    else {
+
+        // Apply each of the tagging criteria defined in the inputs.
+
+        for (int j = 0; j < error_tags.size(); j++) {
+            std::unique_ptr<MultiFab> mf;
+            if (error_tags[j].Field() != std::string()) {
+                mf = derive(error_tags[j].Field(), time, error_tags[j].NGrow());
+            }
+            error_tags[j](tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, level, geom);
+        }
+
+        // Now we'll tag any user-specified zones using the full state array.
 
-    // Now we'll tag any user-specified zones using the full state array.
+        apply_problem_tags(tags, ltime);
 
-    apply_problem_tags(tags, ltime);
+    }
 
     // Finally we'll apply any tagging restrictions which must be obeyed by any setup.
 
     apply_tagging_restrictions(tags, ltime);
 
+    if (verbose)
+    {
+        const int IOProc = ParallelDescriptor::IOProcessorNumber();
+        Real      end    = ParallelDescriptor::second() - strt;
+
+#ifdef BL_LAZY
+        Lazy::QueueReduction( [=] () mutable {
+#endif
+        ParallelDescriptor::ReduceRealMax(end,IOProc);
+        if (ParallelDescriptor::IOProcessor()) {
+          std::cout << "Castro::errorEst() at level " << level << " : time = " << end << std::endl;
+        }
+#ifdef BL_LAZY
+        });
+#endif
+    }
+
+}
+
+
+
+// One refinement indicator as seen by the fused tagging kernel:
+// the test, the component of the shared field MultiFab it reads,
+// and the threshold that applies on this level.
+
+struct FusedTagTest
+{
+    int test;
+    int comp;
+    Real value;
+};
+
+void
+Castro::apply_fused_tags (TagBoxArray& tags, Real time)
+{
+
+    BL_PROFILE("Castro::apply_fused_tags()");
+
+    // Collect the distinct fields needed by the indicators that are
+    // active at this time and on this level. This mirrors the checks
+    // AMRErrorTag makes before applying a test.
+
+    Vector<std::string> fields;
+    Vector<int> field_state_comp;
+
+    int ngrow = 0;
+
+    for (const auto& c : tagging_criteria) {
+        if (time < c.min_time || time > c.max_time || level >= c.max_level) {
+            continue;
+        }
+
+        if (c.test == AMRErrorTag::GRAD || c.test == AMRErrorTag::RELGRAD) {
+            ngrow = 1;
+        }
+
+        if (std::find(fields.begin(), fields.end(), c.field) == fields.end()) {
+            fields.push_back(c.field);
+        }
+    }
+
+    // Order the fields so that State_Type variables come first, sorted
+    // by their component, which lets adjacent ones share a FillPatch.
+
+    auto state_comp = [this] (const std::string& name) -> int {
+        int typ, scomp;
+        if (isStateVariable(name, typ, scomp) && typ == State_Type) {
+            return scomp;
+        }
+        return std::numeric_limits<int>::max();
+    };
+
+    std::stable_sort(fields.begin(), fields.end(),
+                     [&] (const std::string& a, const std::string& b) {
+                         return state_comp(a) < state_comp(b);
+                     });
+
+    for (const auto& name : fields) {
+        field_state_comp.push_back(state_comp(name));
+    }
+
+    const int nfields = fields.size();
+
+    MultiFab field_data;
+
+    if (nfields > 0) {
+
+        field_data.define(grids, dmap, nfields, ngrow);
+
+        int n = 0;
+
+        while (n < nfields) {
+
+            if (field_state_comp[n] == std::numeric_limits<int>::max()) {
+
+                if (derive_lst.canDerive(fields[n])) {
+                    derive(fields[n], time, field_data, n);
+                }
+                else {
+                    // Fields such as the particle counts are only
+                    // available through the allocating derive.
+                    auto mf = derive(fields[n], time, ngrow);
+                    MultiFab::Copy(field_data, *mf, 0, n, 1, ngrow);
+                }
+
+                ++n;
+
+            }
+            else {
+
+                int len = 1;
+                while (n + len < nfields && field_state_comp[n + len] == field_state_comp[n] + len) {
+                    ++len;
+                }
+
+                FillPatch(*this, field_data, ngrow, time, State_Type, field_state_comp[n], len, n);
+
+                n += len;
+
+            }
+
+        }
+
+    }
+
+    // Now build the list of tests, pointing each at its field.
+
+    Vector<FusedTagTest> tests_h;
+
+    for (const auto& c : tagging_criteria) {
+        if (time < c.min_time || time > c.max_time || level >= c.max_level) {
+            continue;
+        }
+
+        FusedTagTest t;
+        t.test = c.test;
+        t.comp = static_cast<int>(std::find(fields.begin(), fields.end(), c.field) - fields.begin());
+        t.value = c.value[std::min(level, static_cast<int>(c.value.size()) - 1)];
+
+        tests_h.push_back(t);
+    }
+
+    const int ntests = tests_h.size();
+
+    Gpu::DeviceVector<FusedTagTest> tests_d(ntests);
+    Gpu::copy(Gpu::hostToDevice, tests_h.begin(), tests_h.end(), tests_d.begin());
+
+    const FusedTagTest* tests = tests_d.data();
+
+    MultiFab& S_new = get_new_data(State_Type);
+
+    const int lev = level;
+
+    const GeometryData& geomdata = geom.data();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(tags, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto tag_arr = tags[mfi].array();
+        const auto state_arr = S_new[mfi].array();
+        const auto dat = nfields > 0 ? field_data[mfi].const_array() : Array4<Real const>();
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            for (int n = 0; n < ntests; ++n) {
+
+                const int c = tests[n].comp;
+                const Real v = dat(i,j,k,c);
+
+                bool set = false;
+
+                if (tests[n].test == AMRErrorTag::GREATER) {
+                    set = v >= tests[n].value;
+                }
+                else if (tests[n].test == AMRErrorTag::LESS) {
+                    set = v <= tests[n].value;
+                }
+                else {
+                    Real grad = amrex::max(std::abs(dat(i+1,j,k,c) - v),
+                                           std::abs(v - dat(i-1,j,k,c)));
+#if AMREX_SPACEDIM >= 2
+                    grad = amrex::max(grad, std::abs(dat(i,j+1,k,c) - v),
+                                            std::abs(v - dat(i,j-1,k,c)));
+#endif
+#if AMREX_SPACEDIM == 3
+                    grad = amrex::max(grad, std::abs(dat(i,j,k+1,c) - v),
+                                            std::abs(v - dat(i,j,k-1,c)));
+#endif
+
+                    if (tests[n].test == AMRErrorTag::GRAD) {
+                        set = grad >= tests[n].value;
+                    }
+                    else {
+                        set = grad >= tests[n].value * std::abs(v);
+                    }
+                }
+
+                if (set) {
+                    tag_arr(i,j,k) = TagBox::SET;
+                }
+
+            }
+
+            problem_tagging(i, j, k, tag_arr, state_arr, lev, geomdata);
+        });
+    }
+
+    Gpu::streamSynchronize();
+
 }
 
 
@@ -3571,6 +4037,34 @@ Castro::check_div_B( MultiFab& Bx,
 }
 #endif
 
+// Find the temperature of zone (i,j,k) from its density and internal
+// energy.  The EOS type is a template parameter so the caller can ask
+// for the extra thermodynamic data (e.g. the sound speed) only when it
+// will use it.
+
+template <typename T>
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void compute_temp_zone (int i, int j, int k, Array4<Real> const& u, T& eos_state)
+{
+    Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+
+    eos_state.rho = u(i,j,k,URHO);
+    eos_state.T   = u(i,j,k,UTEMP); // Initial guess for the EOS
+    eos_state.e   = u(i,j,k,UEINT) * rhoInv;
+    for (int n = 0; n < NumSpec; ++n) {
+        eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+    }
+#if NAUX_NET > 0
+    for (int n = 0; n < NumAux; ++n) {
+        eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+    }
+#endif
+
+    eos(eos_input_re, eos_state);
+
+    u(i,j,k,UTEMP) = eos_state.T;
+}
+
 void
 Castro::computeTemp(
 #ifdef MHD
@@ -3655,6 +4149,27 @@ Castro::computeTemp(
   }
 #endif
 
+  // If this is the new-time state, save the sound speed in the valid
+  // region for the CFL timestep estimate.  We cannot do this if the
+  // state is modified after the EOS call (the ambient clamp) or is not
+  // at cell centers (fourth order).
+
+  const bool is_new_state = state[State_Type].hasNewData() && &State == &get_new_data(State_Type);
+
+  bool store_cs = is_new_state && cache_sound_speed == 1 && clamp_ambient_temp != 1;
+#ifdef TRUE_SDC
+  if (sdc_order == 4) {
+      store_cs = false;
+  }
+#endif
+
+  if (store_cs) {
+      if (sound_speed.boxArray() != State.boxArray() ||
+          sound_speed.DistributionMap() != State.DistributionMap()) {
+          sound_speed.define(State.boxArray(), State.DistributionMap(), 1, 0);
+      }
+  }
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -3679,31 +4194,34 @@ Castro::computeTemp(
 
       Array4<Real> const u = u_fab.array();
 
-      amrex::ParallelFor(bx,
-      [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-      {
-
-          Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+      const Box& vbx = mfi.tilebox();
+      Array4<Real> const cs = store_cs ? sound_speed.array(mfi) : Array4<Real>{};
 
-          eos_re_t eos_state;
+      // The sound speed needs eos_rep_t; otherwise the lighter eos_re_t
+      // is all we need for the temperature.
 
-          eos_state.rho = u(i,j,k,URHO);
-          eos_state.T   = u(i,j,k,UTEMP); // Initial guess for the EOS
-          eos_state.e   = u(i,j,k,UEINT) * rhoInv;
-          for (int n = 0; n < NumSpec; ++n) {
-            eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
-          }
-#if NAUX_NET > 0
-          for (int n = 0; n < NumAux; ++n) {
-            eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
-          }
-#endif
+      if (store_cs) {
+          amrex::ParallelFor(bx,
+          [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+          {
+              eos_rep_t eos_state;
 
-          eos(eos_input_re, eos_state);
+              compute_temp_zone(i, j, k, u, eos_state);
 
-          u(i,j,k,UTEMP) = eos_state.T;
+              if (vbx.contains(IntVect(AMREX_D_DECL(i,j,k)))) {
+                  cs(i,j,k) = eos_state.cs;
+              }
+          });
+      }
+      else {
+          amrex::ParallelFor(bx,
+          [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+          {
+              eos_re_t eos_state;
 
-      });
+              compute_temp_zone(i, j, k, u, eos_state);
+          });
+      }
 
       if (clamp_ambient_temp == 1) {
           amrex::ParallelFor(bx,
@@ -3723,6 +4241,10 @@ Castro::computeTemp(
 
   }
 
+  if (is_new_state) {
+      sound_speed_valid = store_cs;
+  }
+
 #ifdef TRUE_SDC
   if (sdc_order == 4) {
 
@@ -3872,6 +4394,12 @@ Castro::swap_state_time_levels(const Real dt)
           state[k].swapTimeLevels(0.0);
         }
 #endif
+#endif
+
+#ifdef REACTIONS
+        if (k == Work_Estimate_Type) {
+            state[k].swapTimeLevels(0.0);
+        }
 #endif
         state[k].allocOldData();
 
@@ -3922,22 +4450,103 @@ Castro::make_radial_data(int is_new)
    // We only call this for level = 0
    BL_ASSERT(level == 0);
 
+   const Real strt = ParallelDescriptor::second();
+
    int numpts_1d = get_numpts();
 
    auto dx = geom.CellSizeArray();
    Real  dr = dx[0];
 
    auto problo = geom.ProbLoArray();
-   auto probhi = geom.ProbHiArray();
 
    MultiFab& S = is_new ? get_new_data(State_Type) : get_old_data(State_Type);
    const int nc = S.nComp();
 
-   Gpu::ManagedVector<Real> radial_vol(numpts_1d, 0.0_rt);
-   Real* const radial_vol_ptr = radial_vol.dataPtr();
+   // The shell of each zone, from its distance to the center.
+
+   auto shell_index = [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, Real& x, Real& y, Real& z) -> int
+   {
+       x = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0];
+
+       y = 0.0_rt;
+#if AMREX_SPACEDIM >= 2
+       y = problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1] - problem::center[1];
+#endif
+
+       z = 0.0_rt;
+#if AMREX_SPACEDIM == 3
+       z = problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2] - problem::center[2];
+#endif
+
+       Real r = std::sqrt(x * x + y * y + z * z);
+
+       int index = int(r / dr);
 
-   Gpu::ManagedVector<Real> radial_state(numpts_1d * nc, 0.0_rt);
-   Real* const radial_state_ptr = radial_state.dataPtr();
+#ifndef AMREX_USE_GPU
+       if (index > numpts_1d-1) {
+           std::cout << "COMPUTE_AVGSTATE: INDEX TOO BIG " << index << " > " << numpts_1d-1 << "\n";
+           std::cout << "AT (i,j,k) " << i << " " << j << " " << k << "\n";
+           std::cout << "R / DR " << r << " " << dr << "\n";
+           amrex::Error("Error:: Castro_util.H :: compute_avgstate");
+       }
+#endif
+
+       return index;
+   };
+
+   // The shell volumes do not change with the state, so we only sum
+   // them when the grids are new (this is a new level) or the center
+   // has moved.
+
+   bool new_vol = static_cast<int>(radial_vol.size()) != numpts_1d;
+   for (int d = 0; d < 3; ++d) {
+       new_vol = new_vol || radial_vol_center[d] != problem::center[d];
+   }
+
+   if (new_vol) {
+
+       radial_vol.resize(numpts_1d);
+       for (int d = 0; d < 3; ++d) {
+           radial_vol_center[d] = problem::center[d];
+       }
+
+       Real* const radial_vol_ptr = radial_vol.dataPtr();
+
+       for (int n = 0; n < numpts_1d; ++n) {
+           radial_vol_ptr[n] = 0.0_rt;
+       }
+
+       for (MFIter mfi(S); mfi.isValid(); ++mfi)
+       {
+           Box bx(mfi.validbox());
+
+           auto vol_arr = volume[mfi].array();
+
+           amrex::ParallelFor(bx,
+           [=] AMREX_GPU_DEVICE(int i, int j, int k)
+           {
+               Real x, y, z;
+               int index = shell_index(i, j, k, x, y, z);
+
+               Gpu::Atomic::Add(&radial_vol_ptr[index], vol_arr(i,j,k));
+           });
+       }
+
+       Gpu::synchronize();
+
+       ParallelDescriptor::ReduceRealSum(radial_vol.dataPtr(), numpts_1d);
+   }
+
+   // The radial momentum goes into UMX only, and is copied to UMY and
+   // UMZ after the sum, so those two are not summed or reduced: the
+   // sums are packed as nc - 2 components per shell, with the
+   // components above UMZ shifted down by two, and reduced in one
+   // call.  (URHO is the only component below UMX.)
+
+   const int nc_packed = nc - 2;
+
+   Gpu::ManagedVector<Real> radial_sum(numpts_1d * nc_packed, 0.0_rt);
+   Real* const radial_sum_ptr = radial_sum.dataPtr();
 
    for (MFIter mfi(S); mfi.isValid(); ++mfi)
    {
@@ -3949,70 +4558,64 @@ Castro::make_radial_data(int is_new)
        amrex::ParallelFor(bx,
        [=] AMREX_GPU_DEVICE(int i, int j, int k)
        {
-           Real x = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0];
+           Real x, y, z;
+           int index = shell_index(i, j, k, x, y, z);
 
-           Real y = 0.0_rt;
-#if AMREX_SPACEDIM >= 2
-           y = problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1] - problem::center[1];
-#endif
+           Real* sum = radial_sum_ptr + index * nc_packed;
+           const Real vol = vol_arr(i,j,k);
 
-           Real z = 0.0_rt;
-#if AMREX_SPACEDIM == 3
-           z = problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2] - problem::center[2];
-#endif
+           for (int n = 0; n < UMX; ++n) {
+               Gpu::Atomic::Add(&sum[n], vol * state_arr(i,j,k,n));
+           }
 
            Real r = std::sqrt(x * x + y * y + z * z);
 
-           int index = int(r / dr);
+           Real radial_mom = 0.0_rt;
+           if (r > 0.0_rt) {
+               radial_mom = (state_arr(i,j,k,UMX) * x +
+                             state_arr(i,j,k,UMY) * y +
+                             state_arr(i,j,k,UMZ) * z) / r;
+           }
+
+           Gpu::Atomic::Add(&sum[UMX], vol * radial_mom);
 
-#ifndef AMREX_USE_GPU
-           if (index > numpts_1d-1) {
-               std::cout << "COMPUTE_AVGSTATE: INDEX TOO BIG " << index << " > " << numpts_1d-1 << "\n";
-               std::cout << "AT (i,j,k) " << i << " " << j << " " << k << "\n";
-               std::cout << "R / DR " << r << " " << dr << "\n";
-               amrex::Error("Error:: Castro_util.H :: compute_avgstate");
+           for (int n = UMZ + 1; n < nc; ++n) {
+               Gpu::Atomic::Add(&sum[n - 2], vol * state_arr(i,j,k,n));
            }
-#endif
+       });
+   }
 
-           Gpu::Atomic::Add(&radial_state_ptr[URHO + index * nc],
-                            vol_arr(i,j,k) * state_arr(i,j,k,URHO));
+   Gpu::synchronize();
 
-           // Store the radial component of the momentum in the
-           // UMX, UMY and UMZ components for now.
+   ParallelDescriptor::ReduceRealSum(radial_sum.dataPtr(), numpts_1d * nc_packed);
 
-           Real x_mom = state_arr(i,j,k,UMX);
-           Real y_mom = state_arr(i,j,k,UMY);
-           Real z_mom = state_arr(i,j,k,UMZ);
-           Real radial_mom = x_mom * (x / r) + y_mom * (y / r) + z_mom * (z / r);
+   radial_state.resize(numpts_1d * nc);
 
-           Gpu::Atomic::Add(&radial_state_ptr[UMX + index * nc], vol_arr(i,j,k) * radial_mom);
-           Gpu::Atomic::Add(&radial_state_ptr[UMY + index * nc], vol_arr(i,j,k) * radial_mom);
-           Gpu::Atomic::Add(&radial_state_ptr[UMZ + index * nc], vol_arr(i,j,k) * radial_mom);
+   for (int i = 0; i < numpts_1d; i++) {
+       const Real* sum = &radial_sum[nc_packed * i];
+       Real* avg = &radial_state[nc * i];
 
-           for (int n = UMZ + 1; n <= nc; ++n) {
-               Gpu::Atomic::Add(&radial_state_ptr[n + index * nc],
-                                vol_arr(i,j,k) * state_arr(i,j,k,n));
-           }
+       const Real vol_inv = radial_vol[i] > 0.0_rt ? 1.0_rt / radial_vol[i] : 0.0_rt;
 
-           Gpu::Atomic::Add(&radial_vol_ptr[index], vol_arr(i,j,k));
-       });
+       for (int n = 0; n <= UMX; ++n) {
+           avg[n] = sum[n] * vol_inv;
+       }
+       avg[UMY] = avg[UMX];
+       avg[UMZ] = avg[UMX];
+       for (int n = UMZ + 1; n < nc; ++n) {
+           avg[n] = sum[n - 2] * vol_inv;
+       }
    }
 
-   ParallelDescriptor::ReduceRealSum(radial_vol.dataPtr(), numpts_1d);
-   ParallelDescriptor::ReduceRealSum(radial_state.dataPtr(), numpts_1d * nc);
+   if (verbose > 1)
+   {
+       const int IOProc = ParallelDescriptor::IOProcessorNumber();
+       Real      end    = ParallelDescriptor::second() - strt;
 
-   int first = 0;
-   int np_max = 0;
-   for (int i = 0; i < numpts_1d; i++) {
-       if (radial_vol[i] > 0.)
-       {
-           for (int j = 0; j < nc; j++) {
-               radial_state[nc*i+j] /= radial_vol[i];
-           }
-       }
-       else if (first == 0) {
-           np_max = i;
-           first  = 1;
+       ParallelDescriptor::ReduceRealMax(end,IOProc);
+       if (ParallelDescriptor::IOProcessor()) {
+           std::cout << "Castro::make_radial_data() time = " << end
+                     << (new_vol ? " (including the shell volumes)" : "") << std::endl;
        }
    }
 
@@ -285,6 +285,13 @@ Castro::initialize_advance(Real time, Real dt, int amr_iteration, int amr_ncycle
     if (level == 0 && gravity->get_gravity_type() == "PoissonGrav") {
         gravity->update_max_rhs();
     }
+
+    // Save the rate of change of phi over the last step, for the guess
+    // in the new-time solve; this also needs the data before the swap.
+
+    if (do_grav) {
+        gravity->update_phi_rate(level);
+    }
 #endif
 
     // This array holds the source term corrector.
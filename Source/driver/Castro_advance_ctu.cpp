@@ -46,6 +46,19 @@ Castro::do_advance_ctu(Real time,
     MultiFab& Bz_new = get_new_data(Mag_Type_z);
 #endif 
 
+    // If a failure here can be retried locally, we record which zones
+    // failed and carry the advance through to the end, so that the
+    // boxes that are not retried have a complete update.
+
+    const bool local_retry_possible = use_retry == 1 && retry_local == 1 && retry_box_active.empty();
+
+    if (local_retry_possible) {
+        if (retry_tags.boxArray() != grids || retry_tags.DistributionMap() != dmap) {
+            retry_tags.define(grids, dmap, 1, 0);
+        }
+        retry_tags.setVal(0);
+    }
+
     // Perform initialization steps.
 
     initialize_do_advance(time);
@@ -79,6 +92,14 @@ Castro::do_advance_ctu(Real time,
 
         // The result of the reactions is added directly to Sborder.
         burn_success = react_state(Sborder, R_old, prev_time, 0.5 * dt);
+
+        // Keep the zones that failed to burn out of the rest of the first
+        // attempt if they are going to be retried locally.
+
+        if (!burn_success && local_retry_possible) {
+            mask_retry_failed_zones(Sborder, S_old);
+        }
+
         clean_state(
 #ifdef MHD
                     Bx_old_tmp, By_old_tmp, Bz_old_tmp,
@@ -106,7 +127,9 @@ Castro::do_advance_ctu(Real time,
         if (!burn_success) {
             status.success = false;
             status.reason = "first Strang burn unsuccessful";
-            return status;
+            if (!local_retry_possible) {
+                return status;
+            }
         }
 
     }
@@ -191,29 +214,54 @@ Castro::do_advance_ctu(Real time,
           // dynamically important; in that case, a density reset suffices.
 
           if (starting_density >= retry_small_density_cutoff) {
-              status.success = false;
 
-              if (minimum_density < 0.0_rt) {
-                  status.reason = "negative density";
-              }
-              else {
-                  status.reason = "small density";
+              if (local_retry_possible) {
+                  tag_retry_density(S_old, S_new);
               }
 
+              if (status.success) {
+                  status.success = false;
+
+                  if (minimum_density < 0.0_rt) {
+                      status.reason = "negative density";
+                  }
+                  else {
+                      status.reason = "small density";
+                  }
+
               // Add some diagnostic information to the stdout
               // so the user has an idea of what went wrong: the
               // new minimum density, the index it is located at,
               // and the density before the update.
 
-              std::ostringstream ss;
-              ss << std::scientific;
-              ss << " (density = " << minimum_density << " at index " << min_index << ";";
-              ss << " started at " << starting_density << ")";
-              status.reason += ss.str();
+                  std::ostringstream ss;
+                  ss << std::scientific;
+                  ss << " (density = " << minimum_density << " at index " << min_index << ";";
+                  ss << " started at " << starting_density << ")";
+                  status.reason += ss.str();
+              }
 
-              return status;
+              if (!local_retry_possible) {
+                  return status;
+              }
           }
       }
+
+      // If the step is going to be retried locally, the failed zones
+      // must not reach the level-wide gravity solve, burn, and EOS calls
+      // below; they take the start-of-step state for the rest of the
+      // first attempt.
+
+      if (local_retry_possible && !status.success) {
+          mask_retry_failed_zones(S_new, S_old);
+      }
+
+      // During a localized retry, the boxes that are not being advanced
+      // take the first attempt at this time as their boundary data.
+
+      if (!retry_box_active.empty()) {
+          fill_retry_inactive_state(S_new, cur_time);
+      }
     }
 
 
@@ -225,9 +273,12 @@ Castro::do_advance_ctu(Real time,
                 S_new, cur_time, 0);
 
 #ifndef AMREX_USE_GPU
-    // Check for NaN's.
+    // Check for NaN's. A failed update that is going to be retried
+    // locally may legitimately contain bad zones at this point.
 
-    check_for_nan(S_new);
+    if (status.success) {
+        check_for_nan(S_new);
+    }
 #endif
 
     // if we are done with the update do the source correction and
@@ -354,6 +405,11 @@ Castro::do_advance_ctu(Real time,
     if (time_integration_method != SimplifiedSpectralDeferredCorrections) {
 
         burn_success = react_state(S_new, R_new, cur_time - 0.5 * dt, 0.5 * dt);
+
+        if (!burn_success && local_retry_possible) {
+            mask_retry_failed_zones(S_new, S_old);
+        }
+
         clean_state(
 #ifdef MHD
                     Bx_new, By_new, Bz_new,
@@ -362,9 +418,12 @@ Castro::do_advance_ctu(Real time,
 
         // Skip the rest of the advance if the burn was unsuccessful.
 
-        if (!burn_success) {
+        if (!burn_success && status.success) {
             status.success = false;
             status.reason = "second Strang burn unsuccessful";
+        }
+
+        if (!status.success && !local_retry_possible) {
             return status;
         }
 
@@ -386,8 +445,17 @@ Castro::do_advance_ctu(Real time,
     Real new_dt = estTimeStep();
 
     if (castro::change_max * new_dt < dt) {
-        status.success = false;
-        status.reason = "timestep validity check failed";
+        if (local_retry_possible) {
+            tag_retry_cfl(S_new, dt);
+        }
+
+        if (status.success) {
+            status.success = false;
+            status.reason = "timestep validity check failed";
+        }
+    }
+
+    if (!status.success) {
         return status;
     }
 
@@ -611,6 +679,13 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
           state[k].setTimeLevel(subcycle_time + dt_subcycle, dt_subcycle, 0.0);
         }
 
+        // In a localized retry, the boxes that are not advanced follow
+        // the first attempt, interpolated to the start of this subcycle.
+
+        if (!retry_box_active.empty()) {
+            fill_retry_inactive_state(get_old_data(State_Type), subcycle_time);
+        }
+
         // Do the advance and construct the relevant source terms. For CTU this
         // will include Strang-split reactions; for simplified SDC, we defer the
         // burn until after the advance.
@@ -685,6 +760,16 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
 
         if (use_retry) {
 
+            // If the first attempt covered the whole step, see whether
+            // we can limit the retry to the boxes around the failing
+            // zones. This has to happen before retry_advance_ctu, which
+            // clears the fluxes from the first attempt.
+
+            if (!status.success && retry_local == 1 && retry_box_active.empty() &&
+                sub_iteration == 0 && subcycle_time + dt_subcycle >= (1.0 - eps) * (time + dt)) {
+                setup_local_retry(time, dt);
+            }
+
             // If we hit a retry, signal that we want to try again.
             // The retry function will handle resetting the state,
             // and updating dt_subcycle.
@@ -719,6 +804,12 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
     if (verbose && ParallelDescriptor::IOProcessor())
         std::cout << "  Subcycling complete" << std::endl << std::endl;
 
+    // Patch the retried boxes back into the first attempt.
+
+    if (!retry_box_active.empty()) {
+        finish_local_retry(time, dt);
+    }
+
     if (sub_iteration > 1) {
 
         // Finally, copy the original data back to the old state
@@ -766,3 +857,519 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
     return dt_new;
 
 }
+
+
+
+void
+Castro::tag_retry_density(const MultiFab& S_old, const MultiFab& S_new)
+{
+    BL_PROFILE("Castro::tag_retry_density()");
+
+    const Real lsmall_dens = small_dens;
+    const Real cutoff = retry_small_density_cutoff;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(retry_tags, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        const Box& bx = mfi.tilebox();
+
+        auto tags = retry_tags.array(mfi);
+        auto uold = S_old.const_array(mfi);
+        auto unew = S_new.const_array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            // Written this way so that NaN densities are tagged too.
+
+            if (!(unew(i,j,k,URHO) >= lsmall_dens) && uold(i,j,k,URHO) >= cutoff) {
+                tags(i,j,k) = 1;
+            }
+        });
+
+    }
+}
+
+
+
+void
+Castro::tag_retry_cfl(const MultiFab& S_new, Real dt)
+{
+    BL_PROFILE("Castro::tag_retry_cfl()");
+
+    const auto dx = geom.CellSizeArray();
+
+    // A zone fails if change_max times its CFL timestep is less than dt.
+
+    const Real dt_min = dt / (castro::change_max * cfl);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(retry_tags, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        const Box& bx = mfi.tilebox();
+
+        auto tags = retry_tags.array(mfi);
+        auto u = S_new.const_array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+
+            eos_rep_t eos_state;
+            eos_state.rho = u(i,j,k,URHO);
+            eos_state.T = u(i,j,k,UTEMP);
+            eos_state.e = u(i,j,k,UEINT) * rhoInv;
+            for (int n = 0; n < NumSpec; n++) {
+                eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+            }
+#if NAUX_NET > 0
+            for (int n = 0; n < NumAux; n++) {
+                eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+            }
+#endif
+
+            eos(eos_input_re, eos_state);
+
+            Real dt_zone = dx[0] / (eos_state.cs + std::abs(u(i,j,k,UMX) * rhoInv));
+#if AMREX_SPACEDIM >= 2
+            dt_zone = amrex::min(dt_zone, dx[1] / (eos_state.cs + std::abs(u(i,j,k,UMY) * rhoInv)));
+#endif
+#if AMREX_SPACEDIM == 3
+            dt_zone = amrex::min(dt_zone, dx[2] / (eos_state.cs + std::abs(u(i,j,k,UMZ) * rhoInv)));
+#endif
+
+            if (!(dt_zone >= dt_min)) {
+                tags(i,j,k) = 1;
+            }
+        });
+
+    }
+}
+
+
+
+void
+Castro::mask_retry_failed_zones(MultiFab& S, const MultiFab& S_ref)
+{
+    BL_PROFILE("Castro::mask_retry_failed_zones()");
+
+    const int ncomp = S.nComp();
+    const int ng = std::min(S.nGrow(), S_ref.nGrow());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(S, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        const Box& bx = mfi.growntilebox(ng);
+
+        auto s = S.array(mfi);
+        auto s_ref = S_ref.const_array(mfi);
+        auto tags = retry_tags.array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            bool failed = tags.contains(i,j,k) && tags(i,j,k) != 0;
+
+            for (int n = 0; n < ncomp; ++n) {
+                if (!std::isfinite(s(i,j,k,n))) {
+                    failed = true;
+                }
+            }
+
+            if (failed) {
+                for (int n = 0; n < ncomp; ++n) {
+                    s(i,j,k,n) = s_ref(i,j,k,n);
+                }
+
+                if (tags.contains(i,j,k)) {
+                    tags(i,j,k) = 1;
+                }
+            }
+        });
+
+    }
+}
+
+
+
+bool
+Castro::setup_local_retry(Real time, Real dt)
+{
+    BL_PROFILE("Castro::setup_local_retry()");
+
+    if (retry_tags.boxArray() != grids || retry_tags.DistributionMap() != dmap) {
+        return false;
+    }
+
+    const int nboxes = grids.size();
+
+    // Find the boxes that contain a failing zone.
+
+    Vector<int> failed(nboxes, 0);
+
+    for (MFIter mfi(retry_tags); mfi.isValid(); ++mfi) {
+        if (retry_tags[mfi].max<RunOn::Device>(mfi.validbox(), 0) > 0) {
+            failed[mfi.index()] = 1;
+        }
+    }
+
+    ParallelDescriptor::ReduceIntMax(failed.data(), nboxes);
+
+    // Retry every box that lies within the halo of a failed box,
+    // including periodic images.
+
+    Vector<int> active(nboxes, 0);
+
+    const std::vector<IntVect> pshifts = geom.periodicity().shiftIntVect();
+
+    for (int i = 0; i < nboxes; ++i) {
+        if (failed[i] == 0) {
+            continue;
+        }
+
+        const Box halo_box = amrex::grow(grids[i], retry_local_halo);
+
+        for (const auto& iv : pshifts) {
+            for (const auto& isect : grids.intersections(halo_box + iv)) {
+                active[isect.first] = 1;
+            }
+        }
+    }
+
+    Long retry_zones = 0;
+    int retry_boxes = 0;
+
+    for (int i = 0; i < nboxes; ++i) {
+        if (active[i] != 0) {
+            retry_zones += grids[i].numPts();
+            ++retry_boxes;
+        }
+    }
+
+    const Long total_zones = grids.numPts();
+
+    // If nothing was tagged (for example, the step was rejected by a
+    // timestep limiter other than the CFL condition) or too much of the
+    // level would be retried anyway, fall back to the whole-level retry.
+
+    if (retry_zones == 0 || static_cast<Real>(retry_zones) > retry_local_max_fraction * static_cast<Real>(total_zones)) {
+        amrex::Print() << "  Localized retry not used at level " << level << " (" << retry_zones << " of "
+                       << total_zones << " zones marked); retrying the whole level." << std::endl << std::endl;
+        return false;
+    }
+
+    // Save the fluxes of the first attempt for the boxes we keep.
+
+    retry_fluxes.resize(AMREX_SPACEDIM);
+    retry_mass_fluxes.resize(AMREX_SPACEDIM);
+
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        retry_fluxes[dir].reset(new MultiFab(fluxes[dir]->boxArray(), dmap, fluxes[dir]->nComp(), 0));
+        MultiFab::Copy(*retry_fluxes[dir], *fluxes[dir], 0, 0, fluxes[dir]->nComp(), 0);
+
+        retry_mass_fluxes[dir].reset(new MultiFab(mass_fluxes[dir]->boxArray(), dmap, 1, 0));
+        MultiFab::Copy(*retry_mass_fluxes[dir], *mass_fluxes[dir], 0, 0, 1, 0);
+    }
+
+#if (AMREX_SPACEDIM <= 2)
+    if (!Geom().IsCartesian()) {
+        retry_P_radial.reset(new MultiFab(P_radial.boxArray(), dmap, 1, 0));
+        MultiFab::Copy(*retry_P_radial, P_radial, 0, 0, 1, 0);
+    }
+#endif
+
+    retry_box_active = std::move(active);
+
+    amrex::Print() << "  Localized retry at level " << level << " for the step from time " << time
+                   << " with dt = " << dt << ": re-advancing " << retry_zones << " of " << total_zones
+                   << " zones (" << retry_boxes << " of " << nboxes << " boxes)." << std::endl << std::endl;
+
+    return true;
+}
+
+
+
+void
+Castro::fill_retry_inactive_state(MultiFab& S, Real t)
+{
+    BL_PROFILE("Castro::fill_retry_inactive_state()");
+
+    // prev_state holds the start of the step as its old data and
+    // the rejected first attempt as its new data.
+
+    const MultiFab& S_start = prev_state[State_Type]->oldData();
+    const MultiFab& S_attempt = prev_state[State_Type]->newData();
+
+    const Real t_start = prev_state[State_Type]->prevTime();
+    const Real t_end = prev_state[State_Type]->curTime();
+
+    Real alpha = 1.0_rt;
+
+    if (t_end > t_start) {
+        alpha = std::max(0.0_rt, std::min(1.0_rt, (t - t_start) / (t_end - t_start)));
+    }
+
+    const int ncomp = S.nComp();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(S, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        if (retry_box_is_active(mfi.index())) {
+            continue;
+        }
+
+        const Box& bx = mfi.tilebox();
+
+        auto s = S.array(mfi);
+        auto s0 = S_start.const_array(mfi);
+        auto s1 = S_attempt.const_array(mfi);
+
+        amrex::ParallelFor(bx, ncomp,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, int n)
+        {
+            s(i,j,k,n) = (1.0_rt - alpha) * s0(i,j,k,n) + alpha * s1(i,j,k,n);
+        });
+
+    }
+}
+
+
+
+void
+Castro::finish_local_retry(Real time, Real dt)
+{
+    BL_PROFILE("Castro::finish_local_retry()");
+
+    MultiFab& S_new = get_new_data(State_Type);
+
+    // The boxes that were not retried take the first attempt as is.
+
+    fill_retry_inactive_state(S_new, time + dt);
+
+#ifdef REACTIONS
+    MultiFab& R_new = get_new_data(Reactions_Type);
+    const MultiFab& R_attempt = prev_state[Reactions_Type]->newData();
+
+    for (MFIter mfi(R_new, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        if (retry_box_is_active(mfi.index())) {
+            continue;
+        }
+
+        const Box& bx = mfi.tilebox();
+
+        auto r = R_new.array(mfi);
+        auto r_attempt = R_attempt.const_array(mfi);
+
+        amrex::ParallelFor(bx, R_new.nComp(),
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, int n)
+        {
+            r(i,j,k,n) = r_attempt(i,j,k,n);
+        });
+
+    }
+#endif
+
+    // The retried boxes on their own, so that we can find the faces
+    // that the kept boxes share with them.
+
+    BoxList active_bl;
+    Vector<int> active_pmap;
+    Vector<int> active_index;
+
+    Long retry_zones = 0;
+
+    for (int i = 0; i < grids.size(); ++i) {
+        if (retry_box_active[i] != 0) {
+            active_bl.push_back(grids[i]);
+            active_pmap.push_back(dmap[i]);
+            active_index.push_back(i);
+            retry_zones += grids[i].numPts();
+        }
+    }
+
+    const BoxArray active_ba(active_bl);
+    const DistributionMapping active_dm(active_pmap);
+
+    // The data copied from the retried boxes: the NUM_STATE fluxes, a
+    // marker for the faces that received a value, and P_radial on the
+    // radial faces in 1-d/2-d curvilinear geometry (zero otherwise).
+
+    const int imark = NUM_STATE;
+    const int ipres = NUM_STATE + 1;
+    const int nnbr = NUM_STATE + 2;
+
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+
+        bool do_pres = false;
+#if (AMREX_SPACEDIM <= 2)
+        do_pres = dir == 0 && !Geom().IsCartesian();
+#endif
+
+        // Copy the time-integrated fluxes of the retried boxes onto the
+        // faces of the kept boxes.
+
+        MultiFab flux_active(amrex::convert(active_ba, IntVect::TheDimensionVector(dir)),
+                             active_dm, nnbr, 0);
+
+        for (MFIter mfi(flux_active); mfi.isValid(); ++mfi) {
+
+            const Box& nbx = mfi.validbox();
+
+            auto fa = flux_active.array(mfi);
+            auto f = fluxes[dir]->const_array(active_index[mfi.index()]);
+
+            Array4<Real const> pr;
+#if (AMREX_SPACEDIM <= 2)
+            if (do_pres) {
+                pr = P_radial.const_array(active_index[mfi.index()]);
+            }
+#endif
+
+            amrex::ParallelFor(nbx, nnbr,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, int n)
+            {
+                if (n < NUM_STATE) {
+                    fa(i,j,k,n) = f(i,j,k,n);
+                }
+                else if (n == imark) {
+                    fa(i,j,k,n) = 1.0_rt;
+                }
+                else {
+                    fa(i,j,k,n) = do_pres ? pr(i,j,k,0) : 0.0_rt;
+                }
+            });
+
+        }
+
+        MultiFab flux_nbr(fluxes[dir]->boxArray(), dmap, nnbr, 0);
+        flux_nbr.setVal(0.0);
+        flux_nbr.ParallelCopy(flux_active, 0, 0, nnbr, IntVect(0), IntVect(0), geom.periodicity());
+
+        // For the kept boxes, restore the first-attempt fluxes (and
+        // P_radial) except on the shared faces, which take the retried
+        // values. The zone behind each shared face is corrected by the
+        // difference, in the same way as a reflux, so that the patched
+        // level stays conservative. The mass fluxes on the shared faces
+        // are set from the patched fluxes, so that the sources that use
+        // them see the same mass flux as the state update.
+
+        const Real dr = geom.CellSize(0);
+
+        for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+
+            if (retry_box_is_active(mfi.index())) {
+                continue;
+            }
+
+            const Box& bx = mfi.validbox();
+            const Box& nbx = amrex::surroundingNodes(bx, dir);
+
+            const int lo = bx.smallEnd(dir);
+            const int hi = bx.bigEnd(dir);
+
+            auto U = S_new.array(mfi);
+            auto vol = volume.const_array(mfi);
+            auto fnbr = flux_nbr.const_array(mfi);
+            auto f = fluxes[dir]->array(mfi);
+            auto f_attempt = retry_fluxes[dir]->const_array(mfi);
+            auto mf = mass_fluxes[dir]->array(mfi);
+            auto mf_attempt = retry_mass_fluxes[dir]->const_array(mfi);
+
+            Array4<Real> pr;
+            Array4<Real const> pr_attempt;
+#if (AMREX_SPACEDIM <= 2)
+            if (do_pres) {
+                pr = P_radial.array(mfi);
+                pr_attempt = retry_P_radial->const_array(mfi);
+            }
+#endif
+
+            amrex::ParallelFor(nbx,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+            {
+                IntVect face(AMREX_D_DECL(i, j, k));
+
+                const bool shared = fnbr(i,j,k,imark) > 0.5_rt;
+
+                for (int n = 0; n < NUM_STATE; ++n) {
+                    Real F = f_attempt(i,j,k,n);
+
+                    if (shared) {
+                        const Real dF = fnbr(i,j,k,n) - F;
+
+                        if (face[dir] == lo) {
+                            U(face,n) += dF / vol(face);
+                        }
+                        else if (face[dir] == hi + 1) {
+                            IntVect cell = face;
+                            cell[dir] -= 1;
+                            U(cell,n) -= dF / vol(cell);
+                        }
+
+                        F = fnbr(i,j,k,n);
+                    }
+
+                    f(i,j,k,n) = F;
+                }
+
+                mf(i,j,k,0) = shared ? f(i,j,k,URHO) : mf_attempt(i,j,k,0);
+
+                // The radial pressure term is divided by the radial zone
+                // width rather than the volume, as in the pres_reg reflux.
+
+                if (do_pres) {
+                    Real P = pr_attempt(i,j,k,0);
+
+                    if (shared) {
+                        const Real dP = fnbr(i,j,k,ipres) - P;
+
+                        if (face[dir] == lo) {
+                            U(face,UMX) += dP / dr;
+                        }
+                        else if (face[dir] == hi + 1) {
+                            IntVect cell = face;
+                            cell[dir] -= 1;
+                            U(cell,UMX) -= dP / dr;
+                        }
+
+                        P = fnbr(i,j,k,ipres);
+                    }
+
+                    pr(i,j,k,0) = P;
+                }
+            });
+
+        }
+
+    }
+
+    clean_state(
+#ifdef MHD
+                get_new_data(Mag_Type_x), get_new_data(Mag_Type_y), get_new_data(Mag_Type_z),
+#endif
+                S_new, time + dt, 0);
+
+    if (S_new.nGrow() > 0) {
+        expand_state(S_new, time + dt, S_new.nGrow());
+    }
+
+    amrex::Print() << "  Localized retry at level " << level << " complete: " << retry_zones
+                   << " zones re-advanced in " << sub_iteration << " subcycles." << std::endl << std::endl;
+
+    retry_box_active.clear();
+    retry_fluxes.clear();
+    retry_mass_fluxes.clear();
+#if (AMREX_SPACEDIM <= 2)
+    retry_P_radial.reset();
+#endif
+}
@@ -71,12 +71,12 @@ Castro::do_advance_sdc (Real time,
     Real node_time = time + dt_sdc[m]*dt;
 
     // fill Sborder with the starting node's info -- we use S_new as
-    // our staging area.  Note we need to pass new_time here to the
-    // FillPatch so it only pulls from the new MF -- this will not
-    // work for multilevel.
+    // our staging area.  The fill treats S_new as the data at this
+    // node's time, so on a fine level the coarse-fine ghost cells are
+    // interpolated from the coarse level at the node time.
     MultiFab::Copy(S_new, *(k_new[m]), 0, 0, S_new.nComp(), 0);
     clean_state(S_new, cur_time, 0);
-    expand_state(Sborder, cur_time, NUM_GROW);
+    expand_state_at_node(Sborder, State_Type, m, NUM_GROW);
 
 
     // the next chunk of code constructs the advective term for the
@@ -102,7 +102,10 @@ Castro::do_advance_sdc (Real time,
           // if we are 4th order, convert to cell-center Sborder -> Sborder_cc
           // we'll use Sburn for this memory buffer at the moment
 
-          for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+          for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
             const Box& gbx = mfi.growntilebox(1);
 
             make_cell_center(gbx, Sborder.array(mfi), Sburn.array(mfi), domain_lo, domain_hi);
@@ -112,25 +115,26 @@ Castro::do_advance_sdc (Real time,
           // we pass in the stage time here
           do_old_sources(old_source, Sburn, Sburn, node_time, dt, apply_sources_to_state);
 
-          // fill the ghost cells for the sources -- note since we have
-          // not defined the new_source yet, we either need to copy this
-          // into new_source for the time-interpolation in the ghost
-          // fill to make sense, or so long as we are not multilevel,
-          // just use the old time (prev_time) in the fill instead of
-          // the node time (time)
-          AmrLevel::FillPatch(*this, old_source, old_source.nGrow(), prev_time, Source_Type, 0, NSRC);
-
-          // Now convert to cell averages.  This loop cannot be tiled.
-          FArrayBox tmp;
-
-          for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+          // fill the ghost cells for the sources -- new_source is not
+          // defined until the end of the step, so we stage the node's
+          // sources there for the fill at the node time
+          MultiFab::Copy(new_source, old_source, 0, 0, NSRC, 0);
+          expand_state_at_node(old_source, Source_Type, m, old_source.nGrow());
+
+          // Now convert to cell averages.  We keep a copy of the
+          // cell-center sources (in Sburn, which we are done with) so
+          // that the Laplacian is not taken of data that another tile
+          // has already converted.
+          BL_ASSERT(Sburn.nComp() >= NSRC);
+          MultiFab::Copy(Sburn, old_source, 0, 0, NSRC, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+          for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
             const Box& bx = mfi.tilebox();
 
-            tmp.resize(bx, 1);
-            Elixir elix_tmp = tmp.elixir();
-            auto tmp_arr = tmp.array();
-
-            make_fourth_in_place(bx, old_source.array(mfi), tmp_arr, domain_lo, domain_hi);
+            make_fourth_average(bx, old_source.array(mfi), Sburn.array(mfi), domain_lo, domain_hi);
           }
 
         } else {
@@ -145,7 +149,8 @@ Castro::do_advance_sdc (Real time,
         // the well-balanced method in the reconstruction of the
         // pressure.
         if (sdc_order == 2 && use_pslope == 1) {
-          AmrLevel::FillPatch(*this, old_source, old_source.nGrow(), prev_time, Source_Type, 0, NSRC);
+          MultiFab::Copy(new_source, old_source, 0, 0, NSRC, 0);
+          expand_state_at_node(old_source, Source_Type, m, old_source.nGrow());
         }
 #endif
 
@@ -244,9 +249,9 @@ Castro::do_advance_sdc (Real time,
   for (int m = 1; m < SDC_NODES; ++m) {
     // TODO: do we need a clean state here?
     MultiFab::Copy(S_new, *(k_new[m]), 0, 0, S_new.nComp(), 0);
-    expand_state(Sburn, cur_time, 2);
+    expand_state_at_node(Sborder, State_Type, m, 2);
     bool input_is_average = true;
-    construct_old_react_source(Sburn, *(R_old[m]), input_is_average);
+    construct_old_react_source(Sborder, *(R_old[m]), input_is_average);
   }
 #endif
 
@@ -301,14 +306,20 @@ Castro::do_advance_sdc (Real time,
     expand_state(Sborder, cur_time, 2);
   }
 
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+
   FArrayBox U_center;
   FArrayBox R_center;
   FArrayBox tmp;
 
-  // this cannot be tiled
-  for (MFIter mfi(R_new); mfi.isValid(); ++mfi) {
+  // the fourth order conversions below work on per-tile temporaries
+  // that include one ghost cell, so this can be tiled
+  for (MFIter mfi(R_new, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
     const Box& bx = mfi.tilebox();
-    const Box& obx = mfi.growntilebox(1);
+    const Box& obx = amrex::grow(bx, 1);
 
     if (sdc_order == 4) {
 
@@ -354,6 +365,8 @@ Castro::do_advance_sdc (Real time,
 
   }
 
+  }
+
   if (sdc_order == 4) {
     Sborder.clear();
   }
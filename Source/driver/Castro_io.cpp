@@ -12,6 +12,7 @@
 #include <Castro.H>
 #include <Castro_F.H>
 #include <Castro_io.H>
+#include <Derive.H>
 #include <AMReX_ParmParse.H>
 
 #ifdef RADIATION
@@ -30,6 +31,10 @@
 #include <omp.h>
 #endif
 
+#ifdef CXX_MODEL_PARSER
+#include <model_parser_data.H>
+#endif
+
 #include <problem_initialize_state_data.H>
 #include <problem_checkpoint.H>
 #include <problem_restart.H>
@@ -145,6 +150,12 @@ Castro::restart (Amr&     papa,
 
     AmrLevel::restart(papa,is,bReadSpecial);
 
+#ifdef REACTIONS
+    // The work estimate is not stored in the checkpoint, so
+    // start again from a uniform distribution of work.
+    get_new_data(Work_Estimate_Type).setVal(1.0);
+#endif
+
     buildMetrics();
 
     initMFs();
@@ -294,9 +305,6 @@ Castro::restart (Amr&     papa,
 #ifdef GRAVITY
 #if (AMREX_SPACEDIM > 1)
     if ( (level == 0) && (spherical_star == 1) ) {
-       MultiFab& S_new = get_new_data(State_Type);
-       const int nc = S_new.nComp();
-       const int n1d = get_numpts();
        int is_new = 1;
        make_radial_data(is_new);
     }
@@ -495,6 +503,12 @@ Castro::setPlotVariables ()
     parent->deleteStatePlotVar(desc_lst[Source_Type].name(i));
   }
 
+#ifdef REACTIONS
+  // The work estimate is only used for load balancing.
+
+  parent->deleteStatePlotVar(desc_lst[Work_Estimate_Type].name(0));
+#endif
+
 #ifdef SIMPLIFIED_SDC
 #ifdef REACTIONS
   if (time_integration_method == SimplifiedSpectralDeferredCorrections) {
@@ -731,6 +745,23 @@ Castro::writeJobInfo (const std::string& dir, const Real io_time)
   jobInfoFile << "\n\n";
 
 
+#ifdef CXX_MODEL_PARSER
+  // initial model info
+  jobInfoFile << PrettyLine;
+  jobInfoFile << " Initial Model Information\n";
+  jobInfoFile << PrettyLine;
+
+  for (int n = 0; n < NUM_MODELS; n++) {
+    if (!model::filename[n].empty()) {
+      jobInfoFile << " model " << n << ": " << model::filename[n] << "\n";
+      jobInfoFile << "   CRC-32 = " << std::hex << std::setw(8) << std::setfill('0')
+                  << model::checksum[n] << std::dec << std::setfill(' ') << "\n";
+    }
+  }
+  jobInfoFile << "\n\n";
+#endif
+
+
   // species info
   int mlen = 20;
 
@@ -1094,13 +1125,35 @@ Castro::plotFileOutput(const std::string& dir,
     //
     if (dlist.size() > 0)
     {
+        // The EOS-based derived variables all share one EOS evaluation
+        // per zone, rather than each doing its own.  Only do this if
+        // more than one of them is being written.
+
+        int num_eos_derive = 0;
+        for (const auto& name : derive_names) {
+            if (name == "pressure" || name == "soundspeed" || name == "Gamma_1" ||
+                name == "entropy" || name == "MachNumber" ||
+                name == "uplusc" || name == "uminusc" || name == "t_sound_t_enuc") {
+                num_eos_derive++;
+            }
+        }
+
+        MultiFab eos_data;
+        if (num_eos_derive > 1) {
+            eos_data.define(grids, dmap, NUM_EOS_DERIVE, 0);
+            fill_eos_derive_data(eos_data);
+        }
+
         for (auto it = dlist.begin(); it != dlist.end(); ++it)
         {
             if ((parent->isDerivePlotVar(it->name()) && is_small == 0) || 
                 (parent->isDeriveSmallPlotVar(it->name()) && is_small == 1)) {
 
-                auto derive_dat = derive(it->variableName(0), cur_time, nGrow);
-                MultiFab::Copy(plotMF, *derive_dat, 0, cnt, it->numDerive(), nGrow);
+                if (!(num_eos_derive > 1 &&
+                      derive_from_eos_data(it->name(), eos_data, plotMF, cnt))) {
+                    auto derive_dat = derive(it->variableName(0), cur_time, nGrow);
+                    MultiFab::Copy(plotMF, *derive_dat, 0, cnt, it->numDerive(), nGrow);
+                }
                 cnt = cnt + it->numDerive();
 
             }
@@ -25,6 +25,7 @@
 #include <nse.H>
 #endif
 #include <ambient.H>
+#include <eos_table.H>
 
 using std::string;
 using namespace amrex;
@@ -287,6 +288,12 @@ Castro::variableSetUp ()
   castro::small_pres = amrex::max(castro::small_pres, eos_state.p);
   castro::small_ener = amrex::max(castro::small_ener, eos_state.e);
 
+  // build the EOS table for the hydro, now that small_temp is final
+
+  if (castro::use_eos_table == 1) {
+      eos_table::init();
+  }
+
   // some consistency checks on the parameters
 #ifdef REACTIONS
 #ifdef TRUE_SDC
@@ -484,6 +491,17 @@ Castro::variableSetUp ()
 #endif
 #endif
 
+#ifdef REACTIONS
+  // Time-averaged estimate of the work done in each zone (dominated by
+  // the cost of the burn). This is used as the weight when distributing
+  // boxes to ranks if castro.burn_load_balance = 1. Only new-time data
+  // is ever used, and we do not need it in the checkpoint.
+  store_in_checkpoint = false;
+  desc_lst.addDescriptor(Work_Estimate_Type, IndexType::TheCellType(),
+                         StateDescriptor::Point, 0, 1,
+                         &pc_interp, state_data_extrap, store_in_checkpoint);
+#endif
+
   Vector<BCRec>       bcs(NUM_STATE);
   Vector<std::string> name(NUM_STATE);
 
@@ -647,6 +665,9 @@ Castro::variableSetUp ()
   desc_lst.setComponent(Reactions_Type, 0, "rho_enuc", bc, genericBndryFunc);
   desc_lst.setComponent(Reactions_Type, 1, "burn_weights", bc, genericBndryFunc); 
 
+  set_scalar_bc(bc, phys_bc);
+  desc_lst.setComponent(Work_Estimate_Type, 0, "work_estimate", bc, genericBndryFunc);
+
   if (store_omegadot == 1) {
 
       // Reactions_Type includes the species -- we put those after rho_enuc and burn_weights
@@ -10,6 +10,80 @@
 
 using namespace amrex;
 
+// Pointwise pieces of the EOS-based derived variables.  The ca_der*
+// routines and the plotfile path that shares one EOS evaluation
+// between them (Castro::fill_eos_derive_data and
+// Castro::derive_from_eos_data) are both built from these.
+
+template <typename T>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+void
+derive_eos_re (int i, int j, int k, Array4<Real const> const& dat, T& eos_state)
+{
+    Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
+
+    eos_state.rho  = dat(i,j,k,URHO);
+    eos_state.T = dat(i,j,k,UTEMP);
+    eos_state.e = dat(i,j,k,UEINT) * rhoInv;
+    for (int n = 0; n < NumSpec; n++) {
+      eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
+    }
+#if NAUX_NET > 0
+    for (int n = 0; n < NumAux; n++) {
+      eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
+    }
+#endif
+
+    eos(eos_input_re, eos_state);
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+Real
+derive_machnumber (int i, int j, int k, Array4<Real const> const& dat, Real cs)
+{
+    return std::sqrt(dat(i,j,k,UMX)*dat(i,j,k,UMX) +
+                     dat(i,j,k,UMY)*dat(i,j,k,UMY) +
+                     dat(i,j,k,UMZ)*dat(i,j,k,UMZ)) /
+        dat(i,j,k,URHO) / cs;
+}
+
+// u + c (sgn = 1) or u - c (sgn = -1)
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+Real
+derive_u_pm_c (int i, int j, int k, Array4<Real const> const& dat, Real cs, Real sgn)
+{
+    return dat(i,j,k,UMX) / dat(i,j,k,URHO) + sgn * cs;
+}
+
+// ratio of the sound crossing time of a zone to the nuclear
+// energy generation timescale e / enuc
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+Real
+derive_t_sound_t_enuc (Real e, Real enuc, Real dd, Real cs)
+{
+    Real t_e = e / enuc;
+    Real t_s = dd / cs;
+
+    return t_s / t_e;
+}
+
+static Real
+derive_min_dx (const Geometry& geomdata)
+{
+    auto dx = geomdata.CellSizeArray();
+
+    Real dd = 0.0_rt;
+#if AMREX_SPACEDIM == 1
+    dd = dx[0];
+#elif AMREX_SPACEDIM == 2
+    dd = amrex::min(dx[0], dx[1]);
+#else
+    dd = amrex::min(dx[0], dx[1], dx[2]);
+#endif
+
+    return dd;
+}
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -32,23 +106,8 @@ extern "C"
       amrex::ParallelFor(bx,
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
         der(i,j,k,0) = eos_state.p;
       });
@@ -119,25 +178,10 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
-        der(i,j,k,0) = dat(i,j,k,UMX) / dat(i,j,k,URHO) + eos_state.cs;
+        der(i,j,k,0) = derive_u_pm_c(i, j, k, dat, eos_state.cs, 1.0_rt);
 
       });
     }
@@ -154,25 +198,10 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
+        derive_eos_re(i, j, k, dat, eos_state);
 
-        eos(eos_input_re, eos_state);
-
-        der(i,j,k,0) = dat(i,j,k,UMX) / dat(i,j,k,URHO) - eos_state.cs;
+        der(i,j,k,0) = derive_u_pm_c(i, j, k, dat, eos_state.cs, -1.0_rt);
 
       });
     }
@@ -189,23 +218,8 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
         der(i,j,k,0) = eos_state.cs;
 
@@ -225,23 +239,8 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
         der(i,j,k,0) = eos_state.gam1;
 
@@ -260,28 +259,10 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_rep_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
-        der(i,j,k,0) = std::sqrt(dat(i,j,k,UMX)*dat(i,j,k,UMX) +
-                                 dat(i,j,k,UMY)*dat(i,j,k,UMY) +
-                                 dat(i,j,k,UMZ)*dat(i,j,k,UMZ)) /
-          dat(i,j,k,URHO) / eos_state.cs;
+        der(i,j,k,0) = derive_machnumber(i, j, k, dat, eos_state.cs);
 
       });
     }
@@ -298,23 +279,8 @@ extern "C"
       [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
       {
 
-
-        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
         eos_t eos_state;
-        eos_state.rho  = dat(i,j,k,URHO);
-        eos_state.T = dat(i,j,k,UTEMP);
-        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-        for (int n = 0; n < NumSpec; n++) {
-          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-        }
-#if NAUX_NET > 0
-        for (int n = 0; n < NumAux; n++) {
-          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-        }
-#endif
-
-        eos(eos_input_re, eos_state);
+        derive_eos_re(i, j, k, dat, eos_state);
 
         der(i,j,k,0) = eos_state.s;
       });
@@ -441,16 +407,7 @@ extern "C"
       auto const dat = datfab.array();
       auto const der = derfab.array();
 
-      auto dx = geomdata.CellSizeArray();
-
-      Real dd = 0.0_rt;
-#if AMREX_SPACEDIM == 1
-      dd = dx[0];
-#elif AMREX_SPACEDIM == 2
-      dd = amrex::min(dx[0], dx[1]);
-#else
-      dd = amrex::min(dx[0], dx[1], dx[2]);
-#endif
+      const Real dd = derive_min_dx(geomdata);
 
       int enuc_comp = datfab.nComp()-1;
 
@@ -465,28 +422,11 @@ extern "C"
 
         if (enuc > 1.e-100_rt) {
 
-          Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
-
           // calculate the sound speed
           eos_rep_t eos_state;
-          eos_state.rho  = dat(i,j,k,URHO);
-          eos_state.T = dat(i,j,k,UTEMP);
-          eos_state.e = dat(i,j,k,UEINT) * rhoInv;
-          for (int n = 0; n < NumSpec; n++) {
-            eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
-          }
-#if NAUX_NET > 0
-          for (int n = 0; n < NumAux; n++) {
-            eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
-          }
-#endif
-
-          eos(eos_input_re, eos_state);
-
-          Real t_e = eos_state.e / enuc;
-          Real t_s = dd / eos_state.cs;
+          derive_eos_re(i, j, k, dat, eos_state);
 
-          der(i,j,k,0) = t_s/t_e;
+          der(i,j,k,0) = derive_t_sound_t_enuc(eos_state.e, enuc, dd, eos_state.cs);
 
         } else {
           der(i,j,k,0) = 0.0_rt;
@@ -1294,3 +1234,141 @@ extern "C"
 #ifdef __cplusplus
 }
 #endif
+
+
+void
+Castro::fill_eos_derive_data (MultiFab& eos_data)
+{
+    BL_PROFILE("Castro::fill_eos_derive_data()");
+
+    AMREX_ASSERT(eos_data.nComp() == NUM_EOS_DERIVE);
+
+    const MultiFab& S_new = get_new_data(State_Type);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(eos_data, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto const dat = S_new.array(mfi);
+        auto const eos_arr = eos_data.array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            eos_t eos_state;
+            derive_eos_re(i, j, k, dat, eos_state);
+
+            eos_arr(i,j,k,EOS_DERIVE_P) = eos_state.p;
+            eos_arr(i,j,k,EOS_DERIVE_CS) = eos_state.cs;
+            eos_arr(i,j,k,EOS_DERIVE_GAM1) = eos_state.gam1;
+            eos_arr(i,j,k,EOS_DERIVE_S) = eos_state.s;
+        });
+    }
+}
+
+
+bool
+Castro::derive_from_eos_data (const std::string& name, const MultiFab& eos_data,
+                              MultiFab& mf, int dcomp)
+{
+    BL_PROFILE("Castro::derive_from_eos_data()");
+
+    // These use the same pointwise functions as the corresponding
+    // ca_der* routines above, with the EOS call replaced by a lookup.
+
+    int eos_comp = -1;
+
+    if (name == "pressure") {
+        eos_comp = EOS_DERIVE_P;
+    } else if (name == "soundspeed") {
+        eos_comp = EOS_DERIVE_CS;
+    } else if (name == "Gamma_1") {
+        eos_comp = EOS_DERIVE_GAM1;
+    } else if (name == "entropy") {
+        eos_comp = EOS_DERIVE_S;
+    }
+
+    if (eos_comp >= 0) {
+        MultiFab::Copy(mf, eos_data, eos_comp, dcomp, 1, 0);
+        return true;
+    }
+
+    bool is_machnumber = (name == "MachNumber");
+#if AMREX_SPACEDIM == 1
+    bool is_uplusc = (name == "uplusc");
+    bool is_uminusc = (name == "uminusc");
+#else
+    bool is_uplusc = false;
+    bool is_uminusc = false;
+#endif
+#ifdef REACTIONS
+    bool is_enuctimescale = (name == "t_sound_t_enuc");
+#else
+    bool is_enuctimescale = false;
+#endif
+
+    if (!(is_machnumber || is_uplusc || is_uminusc || is_enuctimescale)) {
+        return false;
+    }
+
+    const MultiFab& S_new = get_new_data(State_Type);
+
+    const Real dd = derive_min_dx(geom);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto const dat = S_new.array(mfi);
+        auto const eos_arr = eos_data.array(mfi);
+        auto const der = mf.array(mfi, dcomp);
+
+        if (is_machnumber) {
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+            {
+                der(i,j,k) = derive_machnumber(i, j, k, dat, eos_arr(i,j,k,EOS_DERIVE_CS));
+            });
+
+        } else if (is_uplusc || is_uminusc) {
+
+            const Real sgn = is_uplusc ? 1.0_rt : -1.0_rt;
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+            {
+                der(i,j,k) = derive_u_pm_c(i, j, k, dat, eos_arr(i,j,k,EOS_DERIVE_CS), sgn);
+            });
+
+        }
+#ifdef REACTIONS
+        else if (is_enuctimescale) {
+
+            auto const react = get_new_data(Reactions_Type).array(mfi);
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+            {
+                Real enuc = std::abs(react(i,j,k,0)) / dat(i,j,k,URHO);
+
+                if (enuc > 1.e-100_rt) {
+                    der(i,j,k) = derive_t_sound_t_enuc(dat(i,j,k,UEINT) / dat(i,j,k,URHO), enuc,
+                                                       dd, eos_arr(i,j,k,EOS_DERIVE_CS));
+                } else {
+                    der(i,j,k) = 0.0_rt;
+                }
+            });
+
+        }
+#endif
+    }
+
+    return true;
+}
@@ -0,0 +1,193 @@
+#include <AMReX_FluxRegister.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_MultiFab.H>
+
+#include <reflux_faces.H>
+
+using namespace amrex;
+
+void
+gather_reflux_faces (const FluxRegister& reg, const MultiFab& crse, const Geometry& geom,
+                     int ncomp, RefluxFaces& faces)
+{
+    BL_PROFILE("gather_reflux_faces()");
+
+    const auto& shifts = geom.periodicity().shiftIntVect();
+
+    for (OrientationIter fi; fi; ++fi) {
+
+        const Orientation face = fi();
+        const FabSet& fs = reg[face];
+
+        const BoxArray crse_faces = amrex::convert(crse.boxArray(), IntVect::TheDimensionVector(face.coordDir()));
+        const BoxArray& reg_ba = fs.boxArray();
+
+        // Find the pieces of each coarse grid covered by the register,
+        // including its periodic images.
+
+        Vector<BoxList> grid_faces(crse_faces.size(), BoxList(crse_faces.ixType()));
+
+        for (int i = 0; i < reg_ba.size(); ++i) {
+            for (const auto& iv : shifts) {
+                for (const auto& is : crse_faces.intersections(reg_ba[i] + iv)) {
+                    grid_faces[is.first].push_back(is.second);
+                }
+            }
+        }
+
+        BoxList bl(crse_faces.ixType());
+        Vector<int> procs;
+
+        for (int g = 0; g < grid_faces.size(); ++g) {
+            if (grid_faces[g].isEmpty()) {
+                continue;
+            }
+
+            // Each face must only be applied once per grid.
+
+            BoxArray gba(grid_faces[g]);
+            gba.removeOverlap();
+
+            for (int n = 0; n < gba.size(); ++n) {
+                if (gba[n].ok()) {
+                    bl.push_back(gba[n]);
+                    faces.grid[face].push_back(g);
+                    procs.push_back(crse.DistributionMap()[g]);
+                }
+            }
+        }
+
+        if (faces.grid[face].empty()) {
+            continue;
+        }
+
+        faces.data[face].define(BoxArray(std::move(bl)), DistributionMapping(procs), ncomp, 0);
+        faces.data[face].setVal(0.0);
+
+        fs.copyTo(faces.data[face], 0, 0, 0, ncomp, geom.periodicity());
+
+    }
+}
+
+void
+apply_reflux_faces (const RefluxFaces& faces, MultiFab& dest, int scomp, int dcomp, int ncomp,
+                    const MultiFab* volume, Real const_volume)
+{
+    BL_PROFILE("apply_reflux_faces()");
+
+    for (OrientationIter fi; fi; ++fi) {
+
+        const Orientation face = fi();
+
+        if (faces.grid[face].empty()) {
+            continue;
+        }
+
+        const MultiFab& fmf = faces.data[face];
+
+        // The zone on the low side of a low face and on the high side of a high face.
+        // The register holds F_fine - F_crse, which flows out of that zone across a
+        // low face and into it across a high face.
+
+        const int idir = face.coordDir();
+        const int ioff = (face.isLow() && idir == 0) ? -1 : 0;
+        const int joff = (face.isLow() && idir == 1) ? -1 : 0;
+        const int koff = (face.isLow() && idir == 2) ? -1 : 0;
+        const Real sgn = face.isLow() ? -1.0_rt : 1.0_rt;
+
+        const bool use_volume = volume != nullptr;
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(fmf); mfi.isValid(); ++mfi) {
+
+            const int g = faces.grid[face][mfi.index()];
+
+            const Box& fbx = mfi.validbox();
+            const Box& vbx = dest.boxArray()[g];
+
+            const auto lo = amrex::lbound(vbx);
+            const auto hi = amrex::ubound(vbx);
+
+            auto s = dest.array(g);
+            auto f = fmf.const_array(mfi);
+            auto vol = use_volume ? volume->const_array(g) : Array4<Real const>();
+
+            amrex::ParallelFor(fbx, ncomp,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, int n)
+            {
+                const int ic = i + ioff;
+                const int jc = j + joff;
+                const int kc = k + koff;
+
+                if (ic < lo.x || ic > hi.x || jc < lo.y || jc > hi.y || kc < lo.z || kc > hi.z) {
+                    return;
+                }
+
+                const Real v = use_volume ? vol(ic,jc,kc) : const_volume;
+
+                s(ic,jc,kc,dcomp+n) += sgn * f(i,j,k,scomp+n) / v;
+            });
+
+        }
+
+    }
+}
+
+void
+add_reflux_faces_to_fluxes (const RefluxFaces& faces, const Array<MultiFab*, AMREX_SPACEDIM>& fluxes, int ncomp)
+{
+    BL_PROFILE("add_reflux_faces_to_fluxes()");
+
+    for (OrientationIter fi; fi; ++fi) {
+
+        const Orientation face = fi();
+
+        if (faces.grid[face].empty() || fluxes[face.coordDir()] == nullptr) {
+            continue;
+        }
+
+        const MultiFab& fmf = faces.data[face];
+        MultiFab& flux = *fluxes[face.coordDir()];
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(fmf); mfi.isValid(); ++mfi) {
+
+            const int g = faces.grid[face][mfi.index()];
+
+            auto fl = flux.array(g);
+            auto f = fmf.const_array(mfi);
+
+            amrex::ParallelFor(mfi.validbox(), ncomp,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k, int n)
+            {
+                fl(i,j,k,n) += f(i,j,k,n);
+            });
+
+        }
+
+    }
+}
+
+Long
+reflux_faces_bytes (const RefluxFaces& faces)
+{
+    Long bytes = 0;
+
+    for (OrientationIter fi; fi; ++fi) {
+        const Orientation face = fi();
+
+        if (faces.grid[face].empty()) {
+            continue;
+        }
+
+        for (MFIter mfi(faces.data[face]); mfi.isValid(); ++mfi) {
+            bytes += mfi.validbox().numPts() * faces.data[face].nComp() * static_cast<Long>(sizeof(Real));
+        }
+    }
+
+    return bytes;
+}
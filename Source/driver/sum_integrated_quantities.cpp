@@ -48,98 +48,80 @@ Castro::sum_integrated_quantities ()
     int fixwidth     = 25; // Floating point data not in scientific notation
     int intwidth     = 12; // Integer data
 
-    for (int lev = 0; lev <= finest_level; lev++)
-    {
-        Castro& ca_lev = getLevel(lev);
-
-        mass   += ca_lev.volWgtSum("density", time, local_flag);
-        mom[0] += ca_lev.volWgtSum("xmom", time, local_flag);
-        mom[1] += ca_lev.volWgtSum("ymom", time, local_flag);
-        mom[2] += ca_lev.volWgtSum("zmom", time, local_flag);
-
-        ang_mom[0] += ca_lev.volWgtSum("angular_momentum_x", time, local_flag);
-        ang_mom[1] += ca_lev.volWgtSum("angular_momentum_y", time, local_flag);
-        ang_mom[2] += ca_lev.volWgtSum("angular_momentum_z", time, local_flag);
+    // Gather every quantity we want to integrate, so that they can all
+    // be computed in a single pass over each level and a single reduction.
 
+    Vector<std::string> sum_names = {"density", "xmom", "ymom", "zmom",
+                                     "angular_momentum_x", "angular_momentum_y", "angular_momentum_z",
 #ifdef HYBRID_MOMENTUM
-        hyb_mom[0] += ca_lev.volWgtSum("rmom", time, local_flag);
-        hyb_mom[1] += ca_lev.volWgtSum("lmom", time, local_flag);
-        hyb_mom[2] += ca_lev.volWgtSum("zmom", time, local_flag);
+                                     "rmom", "lmom", "pmom",
 #endif
+                                     "rho_e", "kineng", "rho_E",
+                                     "density_moment_x", "density_moment_y", "density_moment_z"};
 
-        if (show_center_of_mass) {
-           com[0] += ca_lev.locWgtSum("density", time, 0, local_flag);
-           com[1] += ca_lev.locWgtSum("density", time, 1, local_flag);
-           com[2] += ca_lev.locWgtSum("density", time, 2, local_flag);
-        }
-
-       rho_e += ca_lev.volWgtSum("rho_e", time, local_flag);
-       rho_K += ca_lev.volWgtSum("kineng", time, local_flag);
-       rho_E += ca_lev.volWgtSum("rho_E", time, local_flag);
 #ifdef GRAVITY
-        if (gravity->get_gravity_type() == "PoissonGrav")
-               rho_phi += ca_lev.volProductSum("density", "phiGrav", time, local_flag);
+    const int irho_phi = sum_names.size();
+    if (gravity->get_gravity_type() == "PoissonGrav") {
+        sum_names.push_back("rho_phiGrav");
+    }
 #endif
 
+    std::vector<std::string> species_names(NumSpec);
+
+    const int ispec = sum_names.size();
+    for (int i = 0; i < NumSpec; i++) {
+        species_names[i] = desc_lst[State_Type].name(UFS+i);
+        sum_names.push_back(species_names[i]);
+        species_names[i] = species_names[i].substr(4,std::string::npos);
     }
 
-    if (verbose > 0)
+    Vector<Real> sums(sum_names.size(), 0.0);
+    Vector<Real> lev_sums;
+
+    for (int lev = 0; lev <= finest_level; lev++)
     {
+        getLevel(lev).volWgtSums(sum_names, time, lev_sums, local_flag);
 
-#ifdef HYBRID_MOMENTUM
-#ifdef GRAVITY
-       const int nfoo = 14;
-#else
-       const int nfoo = 13;
-#endif
-#else
-#ifdef GRAVITY
-       const int nfoo = 11;
-#else
-       const int nfoo = 10;
-#endif
-#endif
+        for (int n = 0; n < sums.size(); ++n) {
+            sums[n] += lev_sums[n];
+        }
+    }
+
+    ParallelDescriptor::ReduceRealSum(sums.dataPtr(), sums.size());
 
-        Real foo[nfoo] = {mass, mom[0], mom[1], mom[2], ang_mom[0], ang_mom[1], ang_mom[2],
+    {
+        int i = 0;
+        mass       = sums[i++];
+        mom[0]     = sums[i++];
+        mom[1]     = sums[i++];
+        mom[2]     = sums[i++];
+        ang_mom[0] = sums[i++];
+        ang_mom[1] = sums[i++];
+        ang_mom[2] = sums[i++];
 #ifdef HYBRID_MOMENTUM
-                          hyb_mom[0], hyb_mom[1], hyb_mom[2],
+        hyb_mom[0] = sums[i++];
+        hyb_mom[1] = sums[i++];
+        hyb_mom[2] = sums[i++];
 #endif
+        rho_e      = sums[i++];
+        rho_K      = sums[i++];
+        rho_E      = sums[i++];
+        com[0]     = sums[i++];
+        com[1]     = sums[i++];
+        com[2]     = sums[i++];
 #ifdef GRAVITY
-                          rho_e, rho_K, rho_E, rho_phi};
-#else
-                          rho_e, rho_K, rho_E};
-#endif
-
-#ifdef BL_LAZY
-        Lazy::QueueReduction( [=] () mutable {
+        if (gravity->get_gravity_type() == "PoissonGrav") {
+            rho_phi = sums[irho_phi];
+        }
 #endif
+    }
 
-        ParallelDescriptor::ReduceRealSum(foo, nfoo, ParallelDescriptor::IOProcessorNumber());
-
-        if (show_center_of_mass)
-            ParallelDescriptor::ReduceRealSum(com, 3, ParallelDescriptor::IOProcessorNumber());
+    if (verbose > 0)
+    {
 
         if (ParallelDescriptor::IOProcessor()) {
 
-            int i = 0;
-            mass       = foo[i++];
-            mom[0]     = foo[i++];
-            mom[1]     = foo[i++];
-            mom[2]     = foo[i++];
-            ang_mom[0] = foo[i++];
-            ang_mom[1] = foo[i++];
-            ang_mom[2] = foo[i++];
-#ifdef HYBRID_MOMENTUM
-            hyb_mom[0] = foo[i++];
-            hyb_mom[1] = foo[i++];
-            hyb_mom[2] = foo[i++];
-#endif
-            rho_e      = foo[i++];
-            rho_K      = foo[i++];
-            rho_E      = foo[i++];
 #ifdef GRAVITY
-            rho_phi    = foo[i++];
-
             // Total energy is -1/2 * rho * phi + rho * E for self-gravity,
             // and -rho * phi + rho * E for externally-supplied gravity.
             std::string gravity_type = gravity->get_gravity_type();
@@ -239,9 +221,6 @@ Castro::sum_integrated_quantities ()
                 std::cout << "TIME= " << time << " CENTER OF MASS Z-VEL = " << com_vel[2] << '\n';
             }
         }
-#ifdef BL_LAZY
-        });
-#endif
     }
 
 #ifdef GRAVITY
@@ -349,37 +328,12 @@ Castro::sum_integrated_quantities ()
     // Species
 
     {
-        std::vector<Real> species_mass(NumSpec);
-        std::vector<std::string> species_names(NumSpec);
-
-        // Species names
-
-        for (int i = 0; i < NumSpec; i++) {
-            species_names[i] = desc_lst[State_Type].name(UFS+i);
-            species_names[i] = species_names[i].substr(4,std::string::npos);
-            species_mass[i] = 0.0;
-        }
+        // Integrated mass of all species on the domain, computed above.
 
-        // Integrated mass of all species on the domain
-
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            for (int i = 0; i < NumSpec; ++i) {
-                species_mass[i] += getLevel(lev).volWgtSum("rho_" + species_names[i], time, local_flag) / C::M_solar;
-            }
-        }
-
-        int nfoo_sum = NumSpec;
-
-        amrex::Vector<Real> foo_sum(nfoo_sum);
-
-        for (int i = 0; i < NumSpec; ++i) {
-            foo_sum[i] = species_mass[i];
-        }
-
-        amrex::ParallelDescriptor::ReduceRealSum(foo_sum.dataPtr(), nfoo_sum);
+        std::vector<Real> species_mass(NumSpec);
 
         for (int i = 0; i < NumSpec; ++i) {
-            species_mass[i] = foo_sum[i];
+            species_mass[i] = sums[ispec + i] / C::M_solar;
         }
 
         if (ParallelDescriptor::IOProcessor()) {
@@ -12,8 +12,284 @@
 #include <Rotation.H>
 #endif
 
+#include <utility>
+
 using namespace amrex;
 
+namespace {
+
+    // Quantities that volWgtSums() can integrate directly from the
+    // state data in a single pass, without going through derive().
+
+    enum fused_sum_t { fsum_density = 0,
+                       fsum_xmom, fsum_ymom, fsum_zmom,
+                       fsum_ang_mom_x, fsum_ang_mom_y, fsum_ang_mom_z,
+                       fsum_dens_x, fsum_dens_y, fsum_dens_z,
+                       fsum_rho_e, fsum_kineng, fsum_rho_E,
+#ifdef HYBRID_MOMENTUM
+                       fsum_rmom, fsum_lmom, fsum_pmom,
+#endif
+#ifdef GRAVITY
+                       fsum_rho_phi,
+#endif
+                       fsum_spec,
+                       num_fused_sums = fsum_spec + NumSpec };
+
+    // Build a ReduceOps / ReduceData pair that sums num_fused_sums
+    // Reals at once, so that all of the quantities share one pass
+    // over the data and one reduction.
+
+    template <typename T, std::size_t>
+    using repeat_t = T;
+
+    template <typename Seq>
+    struct FusedSum;
+
+    template <std::size_t... I>
+    struct FusedSum<std::index_sequence<I...>>
+    {
+        using Ops   = ReduceOps<repeat_t<ReduceOpSum, I>...>;
+        using Data  = ReduceData<repeat_t<Real, I>...>;
+        using Tuple = typename Data::Type;
+
+        AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+        static Tuple pack (const Real* v)
+        {
+            return Tuple{v[I]...};
+        }
+
+        static void unpack (const Tuple& t, Real* v)
+        {
+            (void) std::initializer_list<int>{(v[I] = amrex::get<I>(t), 0)...};
+        }
+    };
+
+    using fused_sum = FusedSum<std::make_index_sequence<num_fused_sums>>;
+
+    // Map a derived variable name onto the corresponding fused sum,
+    // or return -1 if it must be computed through derive().
+
+    int fused_sum_index (const std::string& name)
+    {
+        if (name == "density")                 return fsum_density;
+        if (name == "xmom")                    return fsum_xmom;
+        if (name == "ymom")                    return fsum_ymom;
+        if (name == "zmom")                    return fsum_zmom;
+        if (name == "angular_momentum_x")      return fsum_ang_mom_x;
+        if (name == "angular_momentum_y")      return fsum_ang_mom_y;
+        if (name == "angular_momentum_z")      return fsum_ang_mom_z;
+        if (name == "density_moment_x")        return fsum_dens_x;
+        if (name == "density_moment_y")        return fsum_dens_y;
+        if (name == "density_moment_z")        return fsum_dens_z;
+        if (name == "rho_e")                   return fsum_rho_e;
+        if (name == "kineng")                  return fsum_kineng;
+        if (name == "rho_E")                   return fsum_rho_E;
+#ifdef HYBRID_MOMENTUM
+        if (name == "rmom")                    return fsum_rmom;
+        if (name == "lmom")                    return fsum_lmom;
+        if (name == "pmom")                    return fsum_pmom;
+#endif
+#ifdef GRAVITY
+        if (name == "rho_phiGrav")             return fsum_rho_phi;
+#endif
+        for (int n = 0; n < NumSpec; ++n) {
+            if (name == "rho_" + short_spec_names_cxx[n]) return fsum_spec + n;
+        }
+
+        return -1;
+    }
+
+}
+
+void
+Castro::volWgtSums (const Vector<std::string>& names,
+                    Real                       time,
+                    Vector<Real>&              sums,
+                    bool                       local,
+                    bool                       finemask)
+{
+    BL_PROFILE("Castro::volWgtSums()");
+
+    const int nnames = names.size();
+
+    sums.resize(nnames);
+
+    Vector<int> index(nnames);
+
+    bool any_fused = false;
+
+    for (int n = 0; n < nnames; ++n) {
+        index[n] = fused_sum_index(names[n]);
+        if (index[n] >= 0) {
+            any_fused = true;
+        }
+    }
+
+    Real fsum[num_fused_sums] = {0.0_rt};
+
+    if (any_fused) {
+
+        // Find the state data at the requested time. We can use the
+        // state data in place at the old or new time; otherwise we
+        // need to interpolate in time.
+
+        MultiFab S_tmp;
+
+        const MultiFab* S_ptr = nullptr;
+
+        const Real eps = 1.e-10_rt * amrex::max(1.e-100_rt, std::abs(state[State_Type].curTime()));
+
+        if (std::abs(time - state[State_Type].curTime()) <= eps) {
+            S_ptr = &get_new_data(State_Type);
+        }
+        else if (state[State_Type].hasOldData() && std::abs(time - state[State_Type].prevTime()) <= eps) {
+            S_ptr = &get_old_data(State_Type);
+        }
+        else {
+            S_tmp.define(grids, dmap, NUM_STATE, 0);
+            AmrLevel::FillPatch(*this, S_tmp, 0, time, State_Type, 0, NUM_STATE);
+            S_ptr = &S_tmp;
+        }
+
+        const MultiFab& S = *S_ptr;
+
+#ifdef GRAVITY
+        MultiFab phi_tmp;
+
+        const MultiFab* phi_ptr = nullptr;
+
+        if (S_ptr == &get_new_data(State_Type)) {
+            phi_ptr = &get_new_data(PhiGrav_Type);
+        }
+        else if (S_ptr == &S_tmp || !state[PhiGrav_Type].hasOldData()) {
+            phi_tmp.define(grids, dmap, 1, 0);
+            AmrLevel::FillPatch(*this, phi_tmp, 0, time, PhiGrav_Type, 0, 1);
+            phi_ptr = &phi_tmp;
+        }
+        else {
+            phi_ptr = &get_old_data(PhiGrav_Type);
+        }
+
+        const MultiFab& phi = *phi_ptr;
+#endif
+
+        const bool use_mask = level < parent->finestLevel() && finemask;
+
+        const MultiFab* mask_ptr = use_mask ? &getLevel(level+1).build_fine_mask() : nullptr;
+
+        auto dx     = geom.CellSizeArray();
+        auto problo = geom.ProbLoArray();
+
+        fused_sum::Ops reduce_op;
+        fused_sum::Data reduce_data(reduce_op);
+        using ReduceTuple = fused_sum::Tuple;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(S, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& box = mfi.tilebox();
+
+            auto const u   = S.const_array(mfi);
+            auto const vol = volume.const_array(mfi);
+            auto const mask = use_mask ? mask_ptr->const_array(mfi) : vol;
+#ifdef GRAVITY
+            auto const phi_arr = phi.const_array(mfi);
+#endif
+
+            reduce_op.eval(box, reduce_data,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                Real v[num_fused_sums];
+
+                Real dV = vol(i,j,k);
+
+                if (use_mask) {
+                    dV *= mask(i,j,k);
+                }
+
+                Real loc[3];
+
+                loc[0] = problo[0] + (0.5_rt + i) * dx[0];
+#if AMREX_SPACEDIM >= 2
+                loc[1] = problo[1] + (0.5_rt + j) * dx[1];
+#else
+                loc[1] = 0.0_rt;
+#endif
+#if AMREX_SPACEDIM == 3
+                loc[2] = problo[2] + (0.5_rt + k) * dx[2];
+#else
+                loc[2] = 0.0_rt;
+#endif
+
+                const Real rho = u(i,j,k,URHO);
+
+                v[fsum_density] = rho * dV;
+
+                v[fsum_xmom] = u(i,j,k,UMX) * dV;
+                v[fsum_ymom] = u(i,j,k,UMY) * dV;
+                v[fsum_zmom] = u(i,j,k,UMZ) * dV;
+
+                v[fsum_dens_x] = rho * loc[0] * dV;
+                v[fsum_dens_y] = rho * loc[1] * dV;
+                v[fsum_dens_z] = rho * loc[2] * dV;
+
+                // The angular momentum is measured relative to the center.
+
+                for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                    loc[dir] -= problem::center[dir];
+                }
+
+                v[fsum_ang_mom_x] = (loc[1] * u(i,j,k,UMZ) - loc[2] * u(i,j,k,UMY)) * dV;
+                v[fsum_ang_mom_y] = (loc[2] * u(i,j,k,UMX) - loc[0] * u(i,j,k,UMZ)) * dV;
+                v[fsum_ang_mom_z] = (loc[0] * u(i,j,k,UMY) - loc[1] * u(i,j,k,UMX)) * dV;
+
+                v[fsum_rho_e] = u(i,j,k,UEINT) * dV;
+                v[fsum_kineng] = 0.5_rt / rho * (u(i,j,k,UMX) * u(i,j,k,UMX) +
+                                                 u(i,j,k,UMY) * u(i,j,k,UMY) +
+                                                 u(i,j,k,UMZ) * u(i,j,k,UMZ)) * dV;
+                v[fsum_rho_E] = u(i,j,k,UEDEN) * dV;
+
+#ifdef HYBRID_MOMENTUM
+                v[fsum_rmom] = u(i,j,k,UMR) * dV;
+                v[fsum_lmom] = u(i,j,k,UML) * dV;
+                v[fsum_pmom] = u(i,j,k,UMP) * dV;
+#endif
+
+#ifdef GRAVITY
+                v[fsum_rho_phi] = rho * phi_arr(i,j,k) * dV;
+#endif
+
+                for (int n = 0; n < NumSpec; ++n) {
+                    v[fsum_spec + n] = u(i,j,k,UFS+n) * dV;
+                }
+
+                return fused_sum::pack(v);
+            });
+        }
+
+        fused_sum::unpack(reduce_data.value(), fsum);
+
+    }
+
+    for (int n = 0; n < nnames; ++n) {
+        if (index[n] >= 0) {
+            sums[n] = fsum[index[n]];
+        }
+        else {
+            // Anything we don't know how to compute directly
+            // (e.g. problem-specific derived variables) goes
+            // through the derive path.
+            sums[n] = volWgtSum(names[n], time, true, finemask);
+        }
+    }
+
+    if (!local) {
+        ParallelDescriptor::ReduceRealSum(sums.dataPtr(), nnames);
+    }
+}
+
 Real
 Castro::volWgtSum (const std::string& name,
                    Real               time,
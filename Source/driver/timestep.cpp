@@ -1,5 +1,6 @@
 #include <Castro.H>
 #include <Castro_F.H>
+#include <eos_table.H>
 
 #ifdef DIFFUSION
 #include <conductivity.H>
@@ -45,6 +46,13 @@ Castro::estdt_cfl(const Real time)
 
   const MultiFab& stateMF = get_new_data(State_Type);
 
+  // computeTemp saves the sound speed of the new-time state, so
+  // unless something has invalidated it we don't need the EOS here.
+
+  const bool use_cached_cs = cache_sound_speed == 1 && sound_speed_valid &&
+                             sound_speed.boxArray() == stateMF.boxArray() &&
+                             sound_speed.DistributionMap() == stateMF.DistributionMap();
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -52,6 +60,7 @@ Castro::estdt_cfl(const Real time)
     const Box& box = mfi.tilebox();
 
     auto u = stateMF.array(mfi);
+    auto cs = use_cached_cs ? sound_speed.const_array(mfi) : Array4<Real const>{};
 
     reduce_op.eval(box, reduce_data,
     [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
@@ -59,20 +68,32 @@ Castro::estdt_cfl(const Real time)
 
       Real rhoInv = 1.0_rt / u(i,j,k,URHO);
 
-      eos_rep_t eos_state;
-      eos_state.rho = u(i,j,k,URHO);
-      eos_state.T = u(i,j,k,UTEMP);
-      eos_state.e = u(i,j,k,UEINT) * rhoInv;
-      for (int n = 0; n < NumSpec; n++) {
-        eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
-      }
+      Real c;
+
+      if (use_cached_cs) {
+
+        c = cs(i,j,k);
+
+      } else {
+
+        eos_rep_t eos_state;
+        eos_state.rho = u(i,j,k,URHO);
+        eos_state.T = u(i,j,k,UTEMP);
+        eos_state.e = u(i,j,k,UEINT) * rhoInv;
+        for (int n = 0; n < NumSpec; n++) {
+          eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+        }
 #if NAUX_NET > 0
-      for (int n = 0; n < NumAux; n++) {
-        eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
-      }
+        for (int n = 0; n < NumAux; n++) {
+          eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+        }
 #endif
 
-      eos(eos_input_re, eos_state);
+        hydro_eos_re(eos_state);
+
+        c = eos_state.cs;
+
+      }
 
       // Compute velocity and then calculate CFL timestep.
 
@@ -95,8 +116,6 @@ Castro::estdt_cfl(const Real time)
       }
 #endif
 
-      Real c = eos_state.cs;
-
       Real dt1 = dx[0]/(c + std::abs(ux));
 
       Real dt2;
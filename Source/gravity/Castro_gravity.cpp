@@ -2,11 +2,7 @@
 #include <Castro_F.H>
 
 #include <Gravity.H>
-
-#ifdef HYBRID_MOMENTUM
-#include <Castro_util.H>
-#include <hybrid.H>
-#endif
+#include <gravity_sources.H>
 
 using namespace amrex;
 
@@ -139,11 +135,11 @@ Castro::construct_new_gravity(int amr_iteration, int amr_ncycle, Real time)
     if (gravity->get_gravity_type() == "PoissonGrav")
     {
 
-        // Use the "old" phi from the current time step as a guess for this solve.
-
-        MultiFab& phi_old = get_old_data(PhiGrav_Type);
+        // Use the "old" phi from the current time step, extrapolated
+        // forward with the rate of change of phi over the last step, as
+        // a guess for this solve.
 
-        MultiFab::Copy(phi_new, phi_old, 0, 0, 1, phi_new.nGrow());
+        gravity->set_new_phi_guess(level, phi_new);
 
         // Subtract off the (composite - level) contribution for the purposes
         // of the level solve. We'll add it back later.
@@ -244,10 +240,6 @@ void Castro::construct_old_gravity_source(MultiFab& source, MultiFab& state_in,
 
     // Gravitational source term for the time-level n data.
 
-#ifdef HYBRID_MOMENTUM
-    GeometryData geomdata = geom.data();
-#endif
-
     AMREX_ALWAYS_ASSERT(castro::grav_source_type >= 1 && castro::grav_source_type <= 4);
 
 #ifdef _OPENMP
@@ -257,108 +249,7 @@ void Castro::construct_old_gravity_source(MultiFab& source, MultiFab& state_in,
     {
         const Box& bx = mfi.tilebox();
 
-        Array4<Real const> const uold = state_in.array(mfi);
-        Array4<Real const> const grav = grav_old.array(mfi);
-        Array4<Real> const source_arr = source.array(mfi);
-
-        amrex::ParallelFor(bx,
-        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-        {
-            // Temporary array for seeing what the new state would be if the update were applied here.
-
-            GpuArray<Real, NUM_STATE> snew;
-            for (int n = 0; n < NUM_STATE; ++n) {
-                snew[n] = 0.0_rt;
-            }
-
-            // Temporary array for holding the update to the state.
-
-            GpuArray<Real, NSRC> src;
-            for (int n = 0; n < NSRC; ++n) {
-                src[n] = 0.0_rt;
-            }
-
-            // Gravitational source options for how to add the work to (rho E):
-            // grav_source_type =
-            // 1: Original version ("does work")
-            // 2: Modification of type 1 that updates the momentum before constructing the energy corrector
-            // 3: Puts all gravitational work into KE, not (rho e)
-            // 4: Conservative energy formulation
-
-            Real rho    = uold(i,j,k,URHO);
-            Real rhoInv = 1.0_rt / rho;
-
-            for (int n = 0; n < NUM_STATE; ++n) {
-                snew[n] = uold(i,j,k,n);
-            }
-
-            Real old_ke = 0.5_rt * (snew[UMX] * snew[UMX] + snew[UMY] * snew[UMY] + snew[UMZ] * snew[UMZ]) * rhoInv;
-
-            GpuArray<Real, 3> Sr;
-            for (int n = 0; n < 3; ++n) {
-                Sr[n] = rho * grav(i,j,k,n);
-
-                src[UMX+n] = Sr[n];
-
-                snew[UMX+n] += dt * src[UMX+n];
-            }
-
-#ifdef HYBRID_MOMENTUM
-            GpuArray<Real, 3> loc;
-            for (int n = 0; n < 3; ++n) {
-                position(i, j, k, geomdata, loc);
-                loc[n] -= problem::center[n];
-            }
-
-            GpuArray<Real, 3> hybrid_src;
-
-            set_hybrid_momentum_source(loc, Sr, hybrid_src);
-
-            for (int n = 0; n < 3; ++n) {
-                 src[UMR+n] = hybrid_src[n];
-                 snew[UMR+n] += dt * src[UMR+n];
-            }
-#endif
-
-            Real SrE;
-
-            if (castro::grav_source_type == 1 || castro::grav_source_type == 2) {
-
-                // Src = rho u dot g, evaluated with all quantities at t^n
-
-                SrE = (uold(i,j,k,UMX) * Sr[0] + uold(i,j,k,UMY) * Sr[1] + uold(i,j,k,UMZ) * Sr[2]) * rhoInv;
-
-            } else if (castro::grav_source_type == 3) {
-
-                Real new_ke = 0.5_rt * (snew[UMX] * snew[UMX] + snew[UMY] * snew[UMY] + snew[UMZ] * snew[UMZ]) * rhoInv;
-                SrE = new_ke - old_ke;
-
-            } else if (castro::grav_source_type == 4) {
-
-                // The conservative energy formulation does not strictly require
-                // any energy source-term here, because it depends only on the
-                // fluid motions from the hydrodynamical fluxes which we will only
-                // have when we get to the 'corrector' step. Nevertheless we add a
-                // predictor energy source term in the way that the other methods
-                // do, for consistency. We will fully subtract this predictor value
-                // during the corrector step, so that the final result is correct.
-                // Here we use the same approach as grav_source_type == 2.
-
-                SrE = (uold(i,j,k,UMX) * Sr[0] + uold(i,j,k,UMY) * Sr[1] + uold(i,j,k,UMZ) * Sr[2]) * rhoInv;
-
-            }
-
-            src[UEDEN] = SrE;
-
-            snew[UEDEN] += dt * SrE;
-
-            // Add to the outgoing source array.
-
-            for (int n = 0; n < NSRC; ++n) {
-                source_arr(i,j,k,n) += src[n];
-            }
-
-        });
+        gsrc(bx, state_in.array(mfi), grav_old.array(mfi), source.array(mfi), dt);
 
     }
 
@@ -392,18 +283,6 @@ void Castro::construct_new_gravity_source(MultiFab& source, MultiFab& state_old,
 
     if (!do_grav) return;
 
-    GpuArray<Real, 3> dx;
-    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-        dx[i] = geom.CellSizeArray()[i];
-    }
-    for (int i = AMREX_SPACEDIM; i < 3; ++i) {
-        dx[i] = 0.0_rt;
-    }
-
-#ifdef HYBRID_MOMENTUM
-    GeometryData geomdata = geom.data();
-#endif
-
     AMREX_ALWAYS_ASSERT(castro::grav_source_type >= 1 && castro::grav_source_type <= 4);
 
 #ifdef _OPENMP
@@ -414,184 +293,12 @@ void Castro::construct_new_gravity_source(MultiFab& source, MultiFab& state_old,
         {
             const Box& bx = mfi.tilebox();
 
-            Array4<Real const> const uold  = state_old.array(mfi);
-            Array4<Real const> const unew  = state_new.array(mfi);
-            Array4<Real const> const gold  = grav_old.array(mfi);
-            Array4<Real const> const gnew  = grav_new.array(mfi);
-            Array4<Real const> const vol   = volume.array(mfi);
-            Array4<Real const> const flux0 = (*mass_fluxes[0]).array(mfi);
-            Array4<Real const> const flux1 = (*mass_fluxes[1]).array(mfi);
-            Array4<Real const> const flux2 = (*mass_fluxes[2]).array(mfi);
-            Array4<Real> const source_arr  = source.array(mfi);
-
-            amrex::ParallelFor(bx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
-                GpuArray<Real, NSRC> src{};
-
-                Real hdtInv = 0.5_rt / dt;
-
-                // Gravitational source options for how to add the work to (rho E):
-                // grav_source_type =
-                // 1: Original version ("does work")
-                // 2: Modification of type 1 that updates the U before constructing SrEcorr
-                // 3: Puts all gravitational work into KE, not (rho e)
-                // 4: Conservative gravity approach (discussed in first white dwarf merger paper).
-
-                Real rhoo    = uold(i,j,k,URHO);
-                Real rhooinv = 1.0_rt / uold(i,j,k,URHO);
-
-                Real rhon    = unew(i,j,k,URHO);
-                Real rhoninv = 1.0_rt / unew(i,j,k,URHO);
-
-                // Temporary array for seeing what the new state would be if the update were applied here.
-
-                GpuArray<Real, NUM_STATE> snew{};
-                for (int n = 0; n < NUM_STATE; ++n) {
-                    snew[n] = unew(i,j,k,n);
-                }
-
-                Real old_ke = 0.5_rt * (snew[UMX] * snew[UMX] + snew[UMY] * snew[UMY] + snew[UMZ] * snew[UMZ]) * rhoninv;
-
-                // Define old source terms
-
-                GpuArray<Real, 3> vold;
-                for (int n = 0; n < 3; ++n) {
-                    vold[n] = uold(i,j,k,UMX+n) * rhooinv;
-                }
-
-                GpuArray<Real, 3> Sr_old;
-                for (int n = 0; n < 3; ++n) {
-                    Sr_old[n] = rhoo * gold(i,j,k,n);
-                }
-
-                Real SrE_old = vold[0] * Sr_old[0] + vold[1] * Sr_old[1] + vold[2] * Sr_old[2];
-
-                // Define new source terms
-
-                GpuArray<Real, 3> vnew;
-                for (int n = 0; n < 3; ++n) {
-                    vnew[n] = snew[UMX+n] * rhoninv;
-                }
-
-                GpuArray<Real, 3> Sr_new;
-                for (int n = 0; n < 3; ++n) {
-                    Sr_new[n] = rhon * gnew(i,j,k,n);
-                }
-
-                Real SrE_new = vnew[0] * Sr_new[0] + vnew[1] * Sr_new[1] + vnew[2] * Sr_new[2];
-
-                // Define corrections to source terms
-
-                GpuArray<Real, 3> Srcorr;
-                for (int n = 0; n < 3; ++n) {
-                    Srcorr[n] = 0.5_rt * (Sr_new[n] - Sr_old[n]);
-                }
-
-                // Correct momenta
-
-                for (int n = 0; n < 3; ++n) {
-                    src[UMX+n] = Srcorr[n];
-                    snew[UMX+n] += dt * src[UMX+n];
-                }
-
-#ifdef HYBRID_MOMENTUM
-                GpuArray<Real, 3> loc;
-                position(i, j, k, geomdata, loc);
-                for (int n = 0; n < 3; ++n) {
-                    loc[n] -= problem::center[n];
-                }
-
-                GpuArray<Real, 3> hybrid_src;
-
-                set_hybrid_momentum_source(loc, Srcorr, hybrid_src);
-
-                for (int n = 0; n < 3; ++n) {
-                    src[UMR+n] = hybrid_src[n];
-                    snew[UMR+n] += dt * src[UMR+n];
-                }
-#endif
-
-                // Correct energy
-
-                Real SrEcorr;
-
-                if (castro::grav_source_type == 1) {
-
-                    // If grav_source_type == 1, then we calculated SrEcorr before updating the velocities.
-
-                    SrEcorr = 0.5_rt * (SrE_new - SrE_old);
-
-                } else if (castro::grav_source_type == 2) {
-
-                    // For this source type, we first update the momenta
-                    // before we calculate the energy source term.
-
-                    for (int n = 0; n < 3; ++n) {
-                        vnew[n] = snew[UMX+n] * rhoninv;
-                    }
-                    SrE_new = vnew[0] * Sr_new[0] + vnew[1] * Sr_new[1] + vnew[2] * Sr_new[2];
-
-                    SrEcorr = 0.5_rt * (SrE_new - SrE_old);
-
-                } else if (castro::grav_source_type == 3) {
-
-                    // Instead of calculating the energy source term explicitly,
-                    // we simply update the kinetic energy.
-
-                    Real new_ke = 0.5_rt * (snew[UMX] * snew[UMX] + snew[UMY] * snew[UMY] + snew[UMZ] * snew[UMZ]) * rhoninv;
-                    SrEcorr = new_ke - old_ke;
-
-                } else if (castro::grav_source_type == 4) {
-
-                    // First, subtract the predictor step we applied earlier.
-
-                    SrEcorr = - SrE_old;
-
-                    // For an explanation of this approach, see wdmerger paper I.
-                    // The main idea is that we are evaluating the change of the
-                    // potential energy at zone edges and applying that in an equal
-                    // and opposite sense to the gas energy. The physics is described
-                    // in Section 2.4; we are using a version of the formula similar to
-                    // Equation 94 in Springel (2010) based on the gradient rather than
-                    // the potential because the gradient-version works for all forms
-                    // of gravity we use, some of which do not explicitly calculate phi.
-
-                    // Construct the time-averaged edge-centered gravity.
-
-                    GpuArray<Real, 3> g;
-                    for (int n = 0; n < 3; ++n) {
-                        g[n] = 0.5_rt * (gnew(i,j,k,n) + gold(i,j,k,n));
-                    }
-
-                    Real gxl = 0.5_rt * (g[0] + 0.5_rt * (gnew(i-1*dg0,j,k,0) + gold(i-1*dg0,j,k,0)));
-                    Real gxr = 0.5_rt * (g[0] + 0.5_rt * (gnew(i+1*dg0,j,k,0) + gold(i+1*dg0,j,k,0)));
-
-                    Real gyl = 0.5_rt * (g[1] + 0.5_rt * (gnew(i,j-1*dg1,k,1) + gold(i,j-1*dg1,k,1)));
-                    Real gyr = 0.5_rt * (g[1] + 0.5_rt * (gnew(i,j+1*dg1,k,1) + gold(i,j+1*dg1,k,1)));
-
-                    Real gzl = 0.5_rt * (g[2] + 0.5_rt * (gnew(i,j,k-1*dg2,2) + gold(i,j,k-1*dg2,2)));
-                    Real gzr = 0.5_rt * (g[2] + 0.5_rt * (gnew(i,j,k+1*dg2,2) + gold(i,j,k+1*dg2,2)));
-
-                    SrEcorr += hdtInv * (flux0(i      ,j,k) * gxl * dx[0] +
-                                         flux0(i+1*dg0,j,k) * gxr * dx[0] +
-                                         flux1(i,j      ,k) * gyl * dx[1] +
-                                         flux1(i,j+1*dg1,k) * gyr * dx[1] +
-                                         flux2(i,j,k      ) * gzl * dx[2] +
-                                         flux2(i,j,k+1*dg2) * gzr * dx[2]) / vol(i,j,k);
-
-                }
-
-                src[UEDEN] = SrEcorr;
-
-                snew[UEDEN] += dt * SrEcorr;
-
-                // Add to the outgoing source array.
-
-                for (int n = 0; n < NSRC; ++n) {
-                    source_arr(i,j,k,n) += src[n];
-                }
-            });
+            corrgsrc(bx,
+                     state_old.array(mfi), state_new.array(mfi),
+                     grav_old.array(mfi), grav_new.array(mfi),
+                     source.array(mfi),
+                     (*mass_fluxes[0]).array(mfi), (*mass_fluxes[1]).array(mfi), (*mass_fluxes[2]).array(mfi),
+                     dt, volume.array(mfi));
         }
     }
 
@@ -612,3 +319,54 @@ void Castro::construct_new_gravity_source(MultiFab& source, MultiFab& state_old,
 #endif
     }
 }
+
+
+
+void
+Castro::gsrc(const Box& bx,
+             Array4<Real const> const& uold,
+             Array4<Real const> const& grav,
+             Array4<Real> const& source_arr,
+             const Real dt)
+{
+    GeometryData geomdata = geom.data();
+
+    amrex::ParallelFor(bx,
+    [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+    {
+        gravity_source_zone(i, j, k, uold, grav, source_arr, dt, geomdata);
+    });
+}
+
+
+
+void
+Castro::corrgsrc(const Box& bx,
+                 Array4<Real const> const& uold,
+                 Array4<Real const> const& unew,
+                 Array4<Real const> const& gold,
+                 Array4<Real const> const& gnew,
+                 Array4<Real> const& source_arr,
+                 Array4<Real const> const& flux0,
+                 Array4<Real const> const& flux1,
+                 Array4<Real const> const& flux2,
+                 const Real dt,
+                 Array4<Real const> const& vol)
+{
+    GpuArray<Real, 3> dx;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        dx[i] = geom.CellSizeArray()[i];
+    }
+    for (int i = AMREX_SPACEDIM; i < 3; ++i) {
+        dx[i] = 0.0_rt;
+    }
+
+    GeometryData geomdata = geom.data();
+
+    amrex::ParallelFor(bx,
+    [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+    {
+        gravity_corrector_zone(i, j, k, uold, unew, gold, gnew, source_arr,
+                               flux0, flux1, flux2, dt, vol, dx, geomdata);
+    });
+}
@@ -89,6 +89,8 @@ Gravity::Gravity(Amr* Parent, int _finest_level, BCRec* _phys_bc, int _Density)
      radial_pres.resize(MAX_LEV);
 #endif
 
+     phi_rate.resize(MAX_LEV);
+
      if (gravity::gravity_type == "PoissonGrav") make_mg_bc();
      if (gravity::gravity_type == "PoissonGrav") init_multipole_grav();
      max_rhs = 0.0;
@@ -142,6 +144,12 @@ Gravity::read_params ()
         }
 #endif
 
+        if (gravity::fft_level0 &&
+            (AMREX_SPACEDIM != 3 || !dgeom.IsCartesian() || gravity::gravity_type != "PoissonGrav"))
+        {
+          amrex::Abort("gravity.fft_level0 requires gravity.gravity_type = PoissonGrav in 3D Cartesian coordinates");
+        }
+
         if (pp.contains("get_g_from_phi") && !gravity::get_g_from_phi && gravity::gravity_type == "PoissonGrav")
           if (ParallelDescriptor::IOProcessor())
             std::cout << "Warning: gravity::gravity_type = PoissonGrav assumes get_g_from_phi is true" << std::endl;
@@ -294,6 +302,12 @@ Gravity::install_level (int                   level,
 
     level_solver_resnorm[level] = 0.0;
 
+    // The grids at this level may have changed, so the saved solvers
+    // and the rate of change of phi are no longer valid.
+
+    clear_mlmg_cache();
+    phi_rate[level].reset();
+
     const Geometry& geom = level_data->Geom();
 
     if (gravity::gravity_type == "PoissonGrav") {
@@ -467,6 +481,8 @@ Gravity::solve_for_phi (int               level,
 
     }
 
+    stats_solve_time += ParallelDescriptor::second() - strt;
+
     if (gravity::verbose)
     {
         const int IOProc = ParallelDescriptor::IOProcessorNumber();
@@ -499,6 +515,9 @@ Gravity::gravity_sync (int crse_level, int fine_level, const Vector<MultiFab*>&
     }
 
     BL_ASSERT(parent->finestLevel()>crse_level);
+
+    const Real strt = ParallelDescriptor::second();
+
     if (gravity::verbose > 1 && ParallelDescriptor::IOProcessor()) {
           std::cout << " ... gravity_sync at crse_level " << crse_level << '\n';
           std::cout << " ...     up to finest_level     " << fine_level << '\n';
@@ -558,8 +577,12 @@ Gravity::gravity_sync (int crse_level, int fine_level, const Vector<MultiFab*>&
          std::cout << " ... Making bc's for delta_phi at crse_level 0"  << std::endl;
 
 #if (AMREX_SPACEDIM == 3)
-      if ( gravity::direct_sum_bcs )
+      if ( gravity::fft_level0 )
+          fill_fft_level0(*rhs[0],*delta_phi[crse_level],false);
+      else if ( gravity::direct_sum_bcs )
           fill_direct_sum_BCs(crse_level,fine_level,amrex::GetVecOfPtrs(rhs),*delta_phi[crse_level]);
+      else if ( gravity::tree_bcs )
+          fill_tree_BCs(crse_level,fine_level,amrex::GetVecOfPtrs(rhs),*delta_phi[crse_level]);
       else {
           fill_multipole_BCs(crse_level,fine_level,amrex::GetVecOfPtrs(rhs),*delta_phi[crse_level]);
       }
@@ -658,6 +681,7 @@ Gravity::gravity_sync (int crse_level, int fine_level, const Vector<MultiFab*>&
 
     }
 
+    stats_solve_time += ParallelDescriptor::second() - strt;
 }
 
 void
@@ -706,8 +730,12 @@ Gravity::multilevel_solve_for_new_phi (int level, int finest_level_in)
        }
     }
 
+    const Real strt = ParallelDescriptor::second();
+
     int is_new = 1;
     actual_multilevel_solve(level, finest_level_in, amrex::GetVecOfVecOfPtrs(grad_phi_curr), is_new);
+
+    stats_solve_time += ParallelDescriptor::second() - strt;
 }
 
 void
@@ -1407,7 +1435,11 @@ Gravity::interpolate_monopole_grav(int level, RealVector& radial_grav, MultiFab&
 
 void
 Gravity::compute_radial_mass(const Box& bx,
-                             Array4<Real const> const u,
+                             Array4<Real const> const u_old,
+                             Array4<Real const> const u_new,
+                             Real alpha,
+                             Array4<Real const> const mask,
+                             bool use_mask,
                              RealVector& radial_mass,
                              RealVector& radial_vol,
 #ifdef GR_GRAV
@@ -1468,9 +1500,26 @@ Gravity::compute_radial_mass(const Box& bx,
     Real* const radial_pres_ptr = radial_pres.dataPtr();
 #endif
 
+    const Real omalpha = 1.0_rt - alpha;
+
     amrex::ParallelFor(bx,
     [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
     {
+        // Component n of the state at the requested time.  Only the
+        // components used here are interpolated, and at the old or new
+        // time only that state is read.
+
+        auto state = [&] (int n) -> Real
+        {
+            if (alpha == 0.0_rt) {
+                return u_old(i,j,k,n);
+            } else if (alpha == 1.0_rt) {
+                return u_new(i,j,k,n);
+            } else {
+                return omalpha * u_old(i,j,k,n) + alpha * u_new(i,j,k,n);
+            }
+        };
+
         Real xc = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0];
         Real lo_i = problo[0] + static_cast<Real>(i) * dx[0] - problem::center[0];
 
@@ -1485,25 +1534,29 @@ Gravity::compute_radial_mass(const Box& bx,
 
         // We may be coming in here with a masked out zone (in a zone on a coarse
         // level underlying a fine level). We don't want to be calling the EOS in
-        // this case, so we'll skip these masked out zones (which will have rho
+        // this case, so we'll skip these masked out zones (and any zones with rho
         // exactly equal to zero).
 
-        if (u(i,j,k,URHO) == 0.0_rt) return;
+        if (use_mask && mask(i,j,k) == 0.0_rt) return;
+
+        const Real rho = state(URHO);
+
+        if (rho == 0.0_rt) return;
 
 #ifdef GR_GRAV
-        Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+        Real rhoInv = 1.0_rt / rho;
 
         eos_t eos_state;
 
-        eos_state.rho = u(i,j,k,URHO);
-        eos_state.e   = u(i,j,k,UEINT) * rhoInv;
-        eos_state.T   = u(i,j,k,UTEMP);
+        eos_state.rho = rho;
+        eos_state.e   = state(UEINT) * rhoInv;
+        eos_state.T   = state(UTEMP);
         for (int n = 0; n < NumSpec; ++n) {
-            eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+            eos_state.xn[n] = state(UFS+n) * rhoInv;
         }
 #if NAUX_NET > 0
         for (int n = 0; n < NumAux; ++n) {
-            eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+            eos_state.aux[n] = state(UFX+n) * rhoInv;
         }
 #endif
 
@@ -1559,7 +1612,7 @@ Gravity::compute_radial_mass(const Box& bx,
                         }
 
                         if (index <= n1d - 1) {
-                            Gpu::Atomic::Add(&radial_mass_ptr[index], vol_frac * u(i,j,k,URHO));
+                            Gpu::Atomic::Add(&radial_mass_ptr[index], vol_frac * rho);
                             Gpu::Atomic::Add(&radial_vol_ptr[index], vol_frac);
 #ifdef GR_GRAV
                             Gpu::Atomic::Add(&radial_pres_ptr[index], vol_frac * eos_state.p);
@@ -1814,6 +1867,14 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
             MultiFab::Multiply(source, mask, 0, 0, 1, 0);
         }
 
+        if (gravity::multipole_cache) {
+            // The cached moments only cover the outermost bin, which
+            // is all we need for the boundary values.
+            BL_ASSERT(boundary_only == 1);
+            add_cached_multipole_moments(lev, source, qL0, qLC, qLS, npts-1);
+            continue;
+        }
+
         // Loop through the grids and compute the individual contributions
         // to the various moments. The multipole moment constructor
         // is coded to only add to the moment arrays, so it is safe
@@ -2232,6 +2293,186 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
 #endif
     }
 
+#if (AMREX_SPACEDIM == 3)
+    if (gravity::multipole_check) {
+        check_multipole_BCs(crse_level, fine_level, Rhs, phi, ParallelDescriptor::second() - strt);
+    }
+#endif
+
+}
+
+void
+Gravity::add_cached_multipole_moments(int lev, const MultiFab& source,
+                                      FArrayBox& qL0, FArrayBox& qLC, FArrayBox& qLS, int n)
+{
+    BL_PROFILE("Gravity::add_cached_multipole_moments()");
+
+    // Drop everything if the quantities the moments depend on,
+    // other than the source itself, have changed.
+
+    bool same_center = true;
+    for (int d = 0; d < 3; ++d) {
+        same_center = same_center && (multipole_cache_center[d] == problem::center[d]);
+    }
+
+    if (multipole_cache_lnum != gravity::lnum || multipole_cache_rmax != multipole::rmax || !same_center) {
+        clear_multipole_cache();
+        multipole_cache_lnum = gravity::lnum;
+        multipole_cache_rmax = multipole::rmax;
+        for (int d = 0; d < 3; ++d) {
+            multipole_cache_center[d] = problem::center[d];
+        }
+    }
+
+    if (multipole_cache_source.size() <= lev) {
+        multipole_cache_source.resize(lev+1);
+        multipole_cache_moments.resize(lev+1);
+    }
+
+    if (!multipole_cache_source[lev] ||
+        multipole_cache_source[lev]->boxArray() != source.boxArray() ||
+        multipole_cache_source[lev]->DistributionMap() != source.DistributionMap()) {
+        multipole_cache_source[lev].reset(new MultiFab(source.boxArray(), source.DistributionMap(), 1, 0));
+        multipole_cache_source[lev]->setVal(0.0);
+        multipole_cache_moments[lev].reset(new LayoutData<FArrayBox>(source.boxArray(), source.DistributionMap()));
+    }
+
+    MultiFab& cached_source = *multipole_cache_source[lev];
+    LayoutData<FArrayBox>& cached_moments = *multipole_cache_moments[lev];
+
+    const Box boxq( IntVect(D_DECL(0, 0, 0)), IntVect(D_DECL(gravity::lnum, gravity::lnum, 0)) );
+
+    const auto dx = parent->Geom(lev).CellSizeArray();
+    const auto problo = parent->Geom(lev).ProbLoArray();
+    const auto probhi = parent->Geom(lev).ProbHiArray();
+    int coord_type = parent->Geom(lev).Coord();
+
+    MultiFab source_change(source.boxArray(), source.DistributionMap(), 1, 0);
+    MultiFab::LinComb(source_change, 1.0, source, 0, -1.0, cached_source, 0, 0, 1, 0);
+
+    int num_reused = 0;
+    int num_computed = 0;
+
+    // No tiling: the partial moments are kept per box. Without
+    // tiling, the boxes are shared out among the OpenMP threads, and
+    // each box's moments are only touched by one thread.
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:num_reused,num_computed)
+#endif
+    for (MFIter mfi(source); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+
+        auto rho = source[mfi].array();
+        auto rho_old = cached_source[mfi].array();
+
+        FArrayBox& q_fab = cached_moments[mfi];
+
+        bool changed = true;
+
+        if (q_fab.isAllocated()) {
+            // The difference is exactly zero only where the source is
+            // unchanged (a NaN compares unequal, so it counts as a change).
+            Real maxdiff = source_change[mfi].maxabs<RunOn::Device>(bx, 0);
+            changed = !(maxdiff == 0.0_rt);
+        }
+        else {
+            q_fab.resize(boxq, 3);
+        }
+
+        if (!changed) {
+            num_reused++;
+            continue;
+        }
+
+        num_computed++;
+
+        q_fab.setVal<RunOn::Device>(0.0);
+
+        auto q = q_fab.array();
+        auto vol = (*volume[lev])[mfi].array();
+
+        amrex::ParallelFor(amrex::Gpu::KernelInfo().setReduction(true), bx,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::Gpu::Handler const& handler)
+        {
+            rho_old(i,j,k) = rho(i,j,k);
+
+            Real rmax_cubed_inv = 1.0_rt / (multipole::rmax * multipole::rmax * multipole::rmax);
+
+            Real x = (problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0]) / multipole::rmax;
+
+#if AMREX_SPACEDIM >= 2
+            Real y = (problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1] - problem::center[1]) / multipole::rmax;
+#else
+            Real y = 0.0_rt;
+#endif
+
+#if AMREX_SPACEDIM == 3
+            Real z = (problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2] - problem::center[2]) / multipole::rmax;
+#else
+            Real z = 0.0_rt;
+#endif
+
+            Real dV = vol(i,j,k) * rmax_cubed_inv;
+
+            if (AMREX_SPACEDIM == 3) {
+                multipole_add_interior_xyz(x, y, z, rho(i,j,k), dV, q, handler, true);
+            }
+            else {
+                Real r = std::sqrt(x * x + y * y + z * z);
+                Real cosTheta = 1.0_rt;
+                if (AMREX_SPACEDIM == 2 && coord_type == 1) {
+                    cosTheta = y / r;
+                }
+                multipole_add_interior(cosTheta, 1.0_rt, 0.0_rt, r, rho(i,j,k), dV, q, handler, true);
+            }
+
+            if (multipole::doSymmetricAdd) {
+                multipole_symmetric_images(x, y, z, problo, probhi,
+                [&] (Real xs, Real ys, Real zs)
+                {
+                    multipole_add_interior_xyz(xs, ys, zs, rho(i,j,k), dV, q, handler);
+                });
+            }
+        });
+    }
+
+    // Sum the per-box moments of this process.
+
+    auto qL0_arr = qL0.array();
+    auto qLC_arr = qLC.array();
+    auto qLS_arr = qLS.array();
+
+    for (MFIter mfi(source); mfi.isValid(); ++mfi)
+    {
+        auto q = cached_moments[mfi].const_array();
+
+        amrex::ParallelFor(boxq,
+        [=] AMREX_GPU_HOST_DEVICE (int l, int m, int)
+        {
+            if (m == 0) {
+                qL0_arr(l,0,n) += q(l,0,0,0);
+            }
+            qLC_arr(l,m,n) += q(l,m,0,1);
+            qLS_arr(l,m,n) += q(l,m,0,2);
+        });
+    }
+
+    if (gravity::verbose > 1) {
+        ParallelDescriptor::ReduceIntSum(num_reused);
+        ParallelDescriptor::ReduceIntSum(num_computed);
+        amrex::Print() << "Gravity::fill_multipole_BCs(): level " << lev << " reused the moments of "
+                       << num_reused << " boxes and computed " << num_computed << std::endl;
+    }
+}
+
+void
+Gravity::clear_multipole_cache()
+{
+    multipole_cache_moments.clear();
+    multipole_cache_source.clear();
+    multipole_cache_lnum = -1;
 }
 
 #if (AMREX_SPACEDIM == 3)
@@ -2258,7 +2499,7 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
     const int hiVectXZ[3] = {domhi[0]+1, 0         , domhi[2]+1};
 
     const int loVectYZ[3] = {0         , domlo[1]-1, domlo[2]-1};
-    const int hiVectYZ[3] = {0         , domhi[1]+1, domhi[1]+1};
+    const int hiVectYZ[3] = {0         , domhi[1]+1, domhi[2]+1};
 
     const int bc_lo[3] = {domlo[0]-1, domlo[1]-1, domlo[2]-1};
     const int bc_hi[3] = {domhi[0]+1, domhi[1]+1, domhi[2]+1};
@@ -2326,7 +2567,7 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
     for (int dir = 0; dir < 3; dir++)
     {
       physbc_lo[dir] = phys_bc->lo(dir);
-      physbc_lo[dir] = phys_bc->hi(dir);
+      physbc_hi[dir] = phys_bc->hi(dir);
     }
 
     for (int lev = crse_level; lev <= fine_level; ++lev) {
@@ -2456,7 +2697,7 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
                                 locb[0] = problo[0];
                             }
                             else if (l == bc_hi[0]) {
-                                locb[0] = probhi[1];
+                                locb[0] = probhi[0];
                             }
                             else {
                                 locb[0] = problo[0] + (static_cast<Real>(l) + 0.5_rt) * bc_dx[0];
@@ -2750,6 +2991,610 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
     }
 
 }
+
+// The largest difference between the boundary values of phi and
+// phi_ref, relative to the largest |phi_ref|, on the first layer of
+// ghost cells outside the coarse domain (where the direct sum fills
+// them).
+
+static Real
+max_rel_bc_difference(const Box& domain, const MultiFab& phi, const MultiFab& phi_ref)
+{
+    const Box bc_box = amrex::grow(domain, 1);
+
+    ReduceOps<ReduceOpMax, ReduceOpMax> reduce_op;
+    ReduceData<Real, Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    for (MFIter mfi(phi); mfi.isValid(); ++mfi)
+    {
+        const Box bx = amrex::grow(mfi.validbox(), 1) & bc_box;
+
+        auto p = phi[mfi].const_array();
+        auto p_ref = phi_ref[mfi].const_array();
+
+        reduce_op.eval(bx, reduce_data,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
+        {
+            if (domain.contains(IntVect(D_DECL(i, j, k)))) {
+                return {0.0_rt, 0.0_rt};
+            }
+            return {std::abs(p(i,j,k) - p_ref(i,j,k)), std::abs(p_ref(i,j,k))};
+        });
+    }
+
+    ReduceTuple hv = reduce_data.value();
+    Real diff[2] = {amrex::get<0>(hv), amrex::get<1>(hv)};
+
+    ParallelDescriptor::ReduceRealMax(diff, 2);
+
+    return diff[1] > 0.0_rt ? diff[0] / diff[1] : diff[0];
+}
+
+void
+Gravity::check_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFab*>& Rhs,
+                             const MultiFab& phi, Real multipole_time)
+{
+    BL_PROFILE("Gravity::check_multipole_BCs()");
+
+    MultiFab phi_ds(phi.boxArray(), phi.DistributionMap(), 1, phi.nGrow());
+    phi_ds.setVal(0.0);
+
+    const Real strt = ParallelDescriptor::second();
+
+    fill_direct_sum_BCs(crse_level, fine_level, Rhs, phi_ds);
+
+    Real direct_sum_time = ParallelDescriptor::second() - strt;
+
+    Real diff = max_rel_bc_difference(parent->Geom(crse_level).Domain(), phi, phi_ds);
+
+    Real times[2] = {multipole_time, direct_sum_time};
+    ParallelDescriptor::ReduceRealMax(times, 2);
+
+    amrex::Print() << "Gravity::check_multipole_BCs(): lnum = " << gravity::lnum
+                   << ", max relative difference from the direct sum = "
+                   << diff << std::endl
+                   << "    multipole time = " << times[0]
+                   << ", direct sum time = " << times[1] << std::endl;
+}
+
+void
+Gravity::fill_tree_BCs(int crse_level, int fine_level, const Vector<MultiFab*>& Rhs, MultiFab& phi)
+{
+    BL_PROFILE("Gravity::fill_tree_BCs()");
+
+    BL_ASSERT(crse_level==0);
+
+    const Real strt = ParallelDescriptor::second();
+
+    const Geometry& crse_geom = parent->Geom(crse_level);
+
+    const int* domlo = crse_geom.Domain().loVect();
+    const int* domhi = crse_geom.Domain().hiVect();
+
+    const GpuArray<int, 3> bc_lo = {domlo[0]-1, domlo[1]-1, domlo[2]-1};
+    const GpuArray<int, 3> bc_hi = {domhi[0]+1, domhi[1]+1, domhi[2]+1};
+
+    const auto bc_dx = crse_geom.CellSizeArray();
+    const auto problo = crse_geom.ProbLoArray();
+    const auto probhi = crse_geom.ProbHiArray();
+
+    // Build the octree over every box on this rank, on all levels.
+    // First lay out the pyramid levels of each box.
+
+    const int nlevs = fine_level - crse_level + 1;
+
+    Vector<tree_level_t> tree_levels;
+    Vector<int> box_first;
+    Vector<int> box_top;
+    Vector<Vector<int>> box_index(nlevs);
+
+    Long nnodes = 0;
+
+    for (int lev = crse_level; lev <= fine_level; ++lev) {
+
+        const MultiFab& rhs = *Rhs[lev - crse_level];
+
+        box_index[lev - crse_level].resize(rhs.local_size());
+
+        for (MFIter mfi(rhs); mfi.isValid(); ++mfi)
+        {
+            box_index[lev - crse_level][mfi.LocalIndex()] = box_first.size();
+            box_first.push_back(tree_levels.size());
+
+            Box cbx = mfi.validbox();
+            int level = 0;
+
+            while (true) {
+                tree_levels.push_back({amrex::lbound(cbx), amrex::ubound(cbx), nnodes, level});
+                nnodes += cbx.numPts();
+
+                if (cbx.longside() <= 2) {
+                    break;
+                }
+
+                cbx.coarsen(2);
+                ++level;
+            }
+
+            AMREX_ALWAYS_ASSERT(level < tree::max_depth);
+
+            box_top.push_back(tree_levels.size() - 1);
+        }
+    }
+
+    const int nboxes = box_top.size();
+
+    Gpu::DeviceVector<tree_level_t> tree_levels_d(tree_levels.size());
+    Gpu::DeviceVector<int> box_top_d(nboxes);
+    Gpu::DeviceVector<Real> nodes_d(nnodes * tree::nnode);
+
+    Gpu::copy(Gpu::hostToDevice, tree_levels.begin(), tree_levels.end(), tree_levels_d.begin());
+    Gpu::copy(Gpu::hostToDevice, box_top.begin(), box_top.end(), box_top_d.begin());
+
+    const tree_level_t* levels_p = tree_levels_d.data();
+    const int* box_top_p = box_top_d.data();
+    Real* nodes = nodes_d.data();
+
+    // Now fill in the nodes: the cells from the masked density, then
+    // each pyramid level from the one below it.
+
+    for (int lev = crse_level; lev <= fine_level; ++lev) {
+
+        MultiFab source(Rhs[lev - crse_level]->boxArray(),
+                        Rhs[lev - crse_level]->DistributionMap(),
+                        1, 0);
+
+        MultiFab::Copy(source, *Rhs[lev - crse_level], 0, 0, 1, 0);
+
+        if (lev < fine_level) {
+            const MultiFab& mask = dynamic_cast<Castro*>(&(parent->getLevel(lev+1)))->build_fine_mask();
+            MultiFab::Multiply(source, mask, 0, 0, 1, 0);
+        }
+
+        const auto dx = parent->Geom(lev).CellSizeArray();
+        const auto plo = parent->Geom(lev).ProbLoArray();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(source); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+
+            const auto rho = source[mfi].const_array();
+            const auto vol = (*volume[lev])[mfi].const_array();
+
+            const int ib = box_index[lev - crse_level][mfi.LocalIndex()];
+
+            const tree_level_t t0 = tree_levels[box_first[ib]];
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+            {
+                Real* n = nodes + tree_node_index(t0, i, j, k) * tree::nnode;
+
+                n[tree::im] = rho(i,j,k) * vol(i,j,k);
+                for (int c = 0; c < 9; ++c) {
+                    n[tree::idip + c] = 0.0_rt;
+                }
+                n[tree::icen  ] = plo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0];
+                n[tree::icen+1] = plo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1];
+                n[tree::icen+2] = plo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2];
+                n[tree::isize] = 0.0_rt;
+            });
+
+            const Dim3 blo = amrex::lbound(bx);
+            const Dim3 bhi = amrex::ubound(bx);
+
+            for (int il = box_first[ib] + 1; il <= box_top[ib]; ++il) {
+
+                const tree_level_t t = tree_levels[il];
+                const tree_level_t tc = tree_levels[il-1];
+
+                const int rr = 1 << t.level;
+
+                const Box cbx(IntVect(t.lo.x, t.lo.y, t.lo.z), IntVect(t.hi.x, t.hi.y, t.hi.z));
+
+                amrex::ParallelFor(cbx,
+                [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+                {
+                    Real* n = nodes + tree_node_index(t, i, j, k) * tree::nnode;
+
+                    // the cells this node covers, and its center and size
+
+                    const int lo[3] = {amrex::max(i * rr, blo.x), amrex::max(j * rr, blo.y), amrex::max(k * rr, blo.z)};
+                    const int hi[3] = {amrex::min(i * rr + rr - 1, bhi.x), amrex::min(j * rr + rr - 1, bhi.y),
+                                       amrex::min(k * rr + rr - 1, bhi.z)};
+
+                    Real cen[3];
+                    Real size = 0.0_rt;
+                    for (int d = 0; d < 3; ++d) {
+                        cen[d] = plo[d] + 0.5_rt * static_cast<Real>(lo[d] + hi[d] + 1) * dx[d];
+                        size = amrex::max(size, static_cast<Real>(hi[d] - lo[d] + 1) * dx[d]);
+                    }
+
+                    // sum the children, shifting their moments to this
+                    // center: with t = c_child - c, D' = D + M t and
+                    // S'_ab = S_ab + D_a t_b + t_a D_b + M t_a t_b
+
+                    Real M = 0.0_rt;
+                    Real D[3] = {0.0_rt};
+                    Real S[6] = {0.0_rt};
+
+                    const int sa[6] = {0, 1, 2, 0, 0, 1};
+                    const int sb[6] = {0, 1, 2, 1, 2, 2};
+
+                    for (int kk = amrex::max(2*k, tc.lo.z); kk <= amrex::min(2*k+1, tc.hi.z); ++kk) {
+                        for (int jj = amrex::max(2*j, tc.lo.y); jj <= amrex::min(2*j+1, tc.hi.y); ++jj) {
+                            for (int ii = amrex::max(2*i, tc.lo.x); ii <= amrex::min(2*i+1, tc.hi.x); ++ii) {
+
+                                const Real* c = nodes + tree_node_index(tc, ii, jj, kk) * tree::nnode;
+
+                                const Real mc = c[tree::im];
+                                const Real* Dc = c + tree::idip;
+                                const Real* Sc = c + tree::isec;
+
+                                Real sh[3];
+                                for (int d = 0; d < 3; ++d) {
+                                    sh[d] = c[tree::icen+d] - cen[d];
+                                }
+
+                                M += mc;
+                                for (int d = 0; d < 3; ++d) {
+                                    D[d] += Dc[d] + mc * sh[d];
+                                }
+                                for (int m = 0; m < 6; ++m) {
+                                    S[m] += Sc[m] + Dc[sa[m]] * sh[sb[m]] + sh[sa[m]] * Dc[sb[m]] +
+                                            mc * sh[sa[m]] * sh[sb[m]];
+                                }
+                            }
+                        }
+                    }
+
+                    n[tree::im] = M;
+                    for (int d = 0; d < 3; ++d) {
+                        n[tree::idip+d] = D[d];
+                        n[tree::icen+d] = cen[d];
+                    }
+                    for (int m = 0; m < 6; ++m) {
+                        n[tree::isec+m] = S[m];
+                    }
+                    n[tree::isize] = size;
+                });
+            }
+        }
+    }
+
+    // Evaluate the potential from this rank's boxes at the boundary
+    // points -- the same points as in fill_direct_sum_BCs -- and their
+    // mirror images across any symmetric boundaries.  Each point is
+    // independent, so there is nothing to accumulate atomically.
+
+    GpuArray<bool, 3> doSymmetricAddLo {false};
+    GpuArray<bool, 3> doSymmetricAddHi {false};
+
+    for (int b = 0; b < 3; ++b) {
+        doSymmetricAddLo[b] = phys_bc->lo(b) == Symmetry;
+        doSymmetricAddHi[b] = phys_bc->hi(b) == Symmetry;
+    }
+
+    const Real theta = gravity::tree_theta;
+
+    // bc[2*dir] and bc[2*dir+1] are the lo and hi faces normal to dir
+    Vector<FArrayBox> bc(6);
+
+    // The tree walk for each boundary point is the expensive part, so on
+    // CPUs each face is cut into tiles that are spread over the OpenMP
+    // threads, as the tree build is above. On GPUs a face is one launch.
+
+    const IntVect face_tile_size(16);
+
+    for (int dir = 0; dir < 3; ++dir) {
+
+        IntVect lo(bc_lo[0], bc_lo[1], bc_lo[2]);
+        IntVect hi(bc_hi[0], bc_hi[1], bc_hi[2]);
+        lo[dir] = 0;
+        hi[dir] = 0;
+
+        const Box face_box(lo, hi);
+
+        BoxArray face_tiles(face_box);
+        if (Gpu::notInLaunchRegion()) {
+            face_tiles.maxSize(face_tile_size);
+        }
+        const int ntiles = face_tiles.size();
+
+        for (int side = 0; side < 2; ++side) {
+
+            FArrayBox& fab = bc[2*dir+side];
+            fab.resize(face_box, 1);
+
+            auto bc_arr = fab.array();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (Gpu::notInLaunchRegion())
+#endif
+            for (int it = 0; it < ntiles; ++it)
+            {
+                const Box tbx = face_tiles[it];
+
+                amrex::ParallelFor(tbx,
+                [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+                {
+                    const int idx[3] = {i, j, k};
+
+                    // The boundary conditions on phi live on the interface,
+                    // and the corners are on the domain edges.
+
+                    GpuArray<Real, 3> locb;
+                    for (int d = 0; d < 3; ++d) {
+                        if (d == dir) {
+                            locb[d] = side == 0 ? problo[d] : probhi[d];
+                        }
+                        else if (idx[d] == bc_lo[d]) {
+                            locb[d] = problo[d];
+                        }
+                        else if (idx[d] == bc_hi[d]) {
+                            locb[d] = probhi[d];
+                        }
+                        else {
+                            locb[d] = problo[d] + (static_cast<Real>(idx[d]) + 0.5_rt) * bc_dx[d];
+                        }
+                    }
+
+                    Real p = tree_potential(locb, levels_p, box_top_p, nboxes, nodes, theta);
+
+                    // The mass hidden behind the symmetric boundaries on the
+                    // lo sides (and, separately, the hi sides) is the mirror
+                    // image of the domain across every combination of them.
+                    // The potential at locb from an image is the potential at
+                    // the image of locb from the domain.
+
+                    for (int s = 0; s < 2; ++s) {
+                        for (int mask = 1; mask < 8; ++mask) {
+                            bool use = true;
+                            GpuArray<Real, 3> loci = locb;
+                            for (int d = 0; d < 3; ++d) {
+                                if (mask & (1 << d)) {
+                                    use = use && (s == 0 ? doSymmetricAddLo[d] : doSymmetricAddHi[d]);
+                                    loci[d] = 2.0_rt * (s == 0 ? problo[d] : probhi[d]) - locb[d];
+                                }
+                            }
+                            if (use) {
+                                p += tree_potential(loci, levels_p, box_top_p, nboxes, nodes, theta);
+                            }
+                        }
+                    }
+
+                    bc_arr(i,j,k) = p;
+                });
+            }
+        }
+    }
+
+    Gpu::synchronize();
+
+    for (int f = 0; f < 6; ++f) {
+        // because the number of elments in mpi_reduce is int
+        BL_ASSERT(bc[f].box().numPts() <= std::numeric_limits<int>::max());
+
+        ParallelDescriptor::ReduceRealSum(bc[f].dataPtr(), bc[f].box().numPts());
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(phi, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx= mfi.growntilebox();
+
+        auto p = phi[mfi].array();
+
+        auto bcYZLo_arr = bc[0].const_array();
+        auto bcYZHi_arr = bc[1].const_array();
+        auto bcXZLo_arr = bc[2].const_array();
+        auto bcXZHi_arr = bc[3].const_array();
+        auto bcXYLo_arr = bc[4].const_array();
+        auto bcXYHi_arr = bc[5].const_array();
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            if (i == bc_lo[0]) {
+                p(i,j,k) = bcYZLo_arr(0,j,k);
+            }
+
+            if (i == bc_hi[0]) {
+                p(i,j,k) = bcYZHi_arr(0,j,k);
+            }
+
+            if (j == bc_lo[1]) {
+                p(i,j,k) = bcXZLo_arr(i,0,k);
+            }
+
+            if (j == bc_hi[1]) {
+                p(i,j,k) = bcXZHi_arr(i,0,k);
+            }
+
+            if (k == bc_lo[2]) {
+                p(i,j,k) = bcXYLo_arr(i,j,0);
+            }
+
+            if (k == bc_hi[2]) {
+                p(i,j,k) = bcXYHi_arr(i,j,0);
+            }
+        });
+    }
+
+    Real tree_time = ParallelDescriptor::second() - strt;
+
+    if (gravity::verbose)
+    {
+        const int IOProc = ParallelDescriptor::IOProcessorNumber();
+        Real      end    = tree_time;
+        Long      ntot   = nnodes;
+
+#ifdef BL_LAZY
+        Lazy::QueueReduction( [=] () mutable {
+#endif
+        ParallelDescriptor::ReduceRealMax(end,IOProc);
+        ParallelDescriptor::ReduceLongSum(ntot,IOProc);
+        if (ParallelDescriptor::IOProcessor())
+            std::cout << "Gravity::fill_tree_BCs() time = " << end
+                      << ", " << ntot << " tree nodes, theta = " << theta << std::endl << std::endl;
+#ifdef BL_LAZY
+        });
+#endif
+    }
+
+    if (gravity::tree_check) {
+        check_tree_BCs(crse_level, fine_level, Rhs, phi, tree_time);
+    }
+}
+
+void
+Gravity::check_tree_BCs(int crse_level, int fine_level, const Vector<MultiFab*>& Rhs,
+                        const MultiFab& phi, Real tree_time)
+{
+    BL_PROFILE("Gravity::check_tree_BCs()");
+
+    MultiFab phi_ds(phi.boxArray(), phi.DistributionMap(), 1, phi.nGrow());
+    MultiFab phi_mp(phi.boxArray(), phi.DistributionMap(), 1, phi.nGrow());
+    phi_ds.setVal(0.0);
+    phi_mp.setVal(0.0);
+
+    Real strt = ParallelDescriptor::second();
+
+    fill_direct_sum_BCs(crse_level, fine_level, Rhs, phi_ds);
+
+    Real direct_sum_time = ParallelDescriptor::second() - strt;
+
+    strt = ParallelDescriptor::second();
+
+    fill_multipole_BCs(crse_level, fine_level, Rhs, phi_mp);
+
+    Real multipole_time = ParallelDescriptor::second() - strt;
+
+    const Box& domain = parent->Geom(crse_level).Domain();
+
+    Real tree_diff = max_rel_bc_difference(domain, phi, phi_ds);
+    Real multipole_diff = max_rel_bc_difference(domain, phi_mp, phi_ds);
+
+    Real times[3] = {tree_time, multipole_time, direct_sum_time};
+    ParallelDescriptor::ReduceRealMax(times, 3);
+
+    amrex::Print() << "Gravity::check_tree_BCs(): max relative difference from the direct sum:" << std::endl
+                   << "    tree (theta = " << gravity::tree_theta << ") = " << tree_diff
+                   << ", multipole (lnum = " << gravity::lnum << ") = " << multipole_diff << std::endl
+                   << "    tree time = " << times[0]
+                   << ", multipole time = " << times[1]
+                   << ", direct sum time = " << times[2] << std::endl;
+}
+
+void
+Gravity::fill_fft_level0(const MultiFab& rho, MultiFab& phi, bool fill_valid)
+{
+    BL_PROFILE("Gravity::fill_fft_level0()");
+
+    const Real strt = ParallelDescriptor::second();
+
+    const Geometry& geom = parent->Geom(0);
+
+    if (!fft_poisson) {
+        fft_poisson.reset(new FFTPoisson(geom));
+    }
+
+    MultiFab phi_fft(phi.boxArray(), phi.DistributionMap(), 1, 1);
+
+    fft_poisson->solve(rho, phi_fft);
+
+    // The FFT gives phi at the cell centers of the first layer of ghost
+    // cells, but MLMG takes the Dirichlet value at the domain face from
+    // them, so interpolate to the face (quadratically, from the ghost
+    // cell and the two cells inside) in each direction the cell is
+    // outside the domain.
+
+    const Box& domain = geom.Domain();
+    const Box gdomain = amrex::grow(domain, 1);
+
+    const auto domlo = amrex::lbound(domain);
+    const auto domhi = amrex::ubound(domain);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(phi); mfi.isValid(); ++mfi)
+    {
+        const Box bx = amrex::grow(mfi.validbox(), 1) & gdomain;
+
+        auto p = phi.array(mfi);
+        auto f = phi_fft.const_array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            const int idx[3] = {i, j, k};
+            const int lo[3] = {domlo.x, domlo.y, domlo.z};
+            const int hi[3] = {domhi.x, domhi.y, domhi.z};
+
+            // offsets and weights of the stencil in each direction
+
+            int off[3][3];
+            Real w[3][3];
+            int npts[3];
+            bool inside = true;
+
+            for (int d = 0; d < 3; ++d) {
+                if (idx[d] < lo[d] || idx[d] > hi[d]) {
+                    const int s = idx[d] < lo[d] ? 1 : -1;
+                    off[d][0] = 0;
+                    off[d][1] = s;
+                    off[d][2] = 2 * s;
+                    w[d][0] = 0.375_rt;
+                    w[d][1] = 0.75_rt;
+                    w[d][2] = -0.125_rt;
+                    npts[d] = 3;
+                    inside = false;
+                } else {
+                    off[d][0] = 0;
+                    w[d][0] = 1.0_rt;
+                    npts[d] = 1;
+                }
+            }
+
+            if (inside) {
+                if (fill_valid) {
+                    p(i,j,k) = f(i,j,k);
+                }
+                return;
+            }
+
+            Real sum = 0.0_rt;
+            for (int a = 0; a < npts[0]; ++a) {
+                for (int b = 0; b < npts[1]; ++b) {
+                    for (int c = 0; c < npts[2]; ++c) {
+                        sum += w[0][a] * w[1][b] * w[2][c] *
+                               f(i + off[0][a], j + off[1][b], k + off[2][c]);
+                    }
+                }
+            }
+
+            p(i,j,k) = sum;
+        });
+    }
+
+    if (gravity::verbose)
+    {
+        const int IOProc = ParallelDescriptor::IOProcessorNumber();
+        Real      end    = ParallelDescriptor::second() - strt;
+
+        ParallelDescriptor::ReduceRealMax(end,IOProc);
+        if (ParallelDescriptor::IOProcessor())
+            std::cout << "Gravity::fill_fft_level0() time = " << end
+                      << " (FFT arrays: " << fft_poisson->bytes() << " bytes)" << std::endl << std::endl;
+    }
+}
 #endif
 
 #if (AMREX_SPACEDIM < 3)
@@ -2959,14 +3804,30 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
 
     Real sum_over_levels = 0.;
 
+    // the state components compute_radial_mass reads
+#ifdef GR_GRAV
+    const int radial_mass_ncomp = 3 + NumSpec + NumAux;
+#else
+    const int radial_mass_ncomp = 1;
+#endif
+
+    // the bytes of state (and mask) data read while binning, and the
+    // least that building a NUM_STATE copy of the same state would move
+    Real state_bytes = 0.;
+    Real copy_bytes = 0.;
+
     for (int lev = 0; lev <= level; lev++)
     {
         const Real t_old = LevelData[lev]->get_state_data(State_Type).prevTime();
         const Real t_new = LevelData[lev]->get_state_data(State_Type).curTime();
         const Real eps   = (t_new - t_old) * 1.e-6;
 
-        // Create MultiFab with NUM_STATE components and no ghost cells
-        MultiFab S(grids[lev],dmap[lev],NUM_STATE,0);
+        // Rather than build a time-interpolated, masked copy of the whole
+        // state, compute_radial_mass reads the old and new state in place
+        // and interpolates only the components it needs.  alpha is the
+        // weight of the new time.
+
+        Real alpha;
 
         if ( eps == 0.0 )
         {
@@ -2974,29 +3835,19 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
             // dt is smaller than roundoff compared to the current time,
             // in which case we're probably in trouble anyway,
             // but we will still handle it gracefully here.
-            MultiFab::Copy(S, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 1.0;
         }
         else if ( std::abs(time-t_old) < eps)
         {
-            MultiFab::Copy(S, LevelData[lev]->get_old_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 0.0;
         }
         else if ( std::abs(time-t_new) < eps)
         {
-            MultiFab::Copy(S, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 1.0;
         }
         else if (time > t_old && time < t_new)
         {
-            Real alpha   = (time - t_old)/(t_new - t_old);
-            Real omalpha = 1.0 - alpha;
-
-            MultiFab::Copy(S, LevelData[lev]->get_old_data(State_Type), 0, 0, NUM_STATE, 0);
-            S.mult(omalpha);
-
-            MultiFab S_new(grids[lev],dmap[lev],NUM_STATE,0);
-            MultiFab::Copy(S_new, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
-            S_new.mult(alpha);
-
-            S.plus(S_new,0,NUM_STATE,0);
+            alpha = (time - t_old)/(t_new - t_old);
         }
         else
         {
@@ -3005,14 +3856,24 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
             amrex::Abort("Problem in Gravity::make_radial_gravity");
         }
 
+        const MultiFab& S_old = alpha == 1.0 ? LevelData[lev]->get_new_data(State_Type)
+                                             : LevelData[lev]->get_old_data(State_Type);
+        const MultiFab& S_new = alpha == 0.0 ? LevelData[lev]->get_old_data(State_Type)
+                                             : LevelData[lev]->get_new_data(State_Type);
+
+        const MultiFab* mask = nullptr;
+
         if (lev < level)
         {
             Castro* fine_level = dynamic_cast<Castro*>(&(parent->getLevel(lev+1)));
-            const MultiFab& mask = fine_level->build_fine_mask();
-            for (int n = 0; n < NUM_STATE; ++n)
-                MultiFab::Multiply(S, mask, 0, n, 1, 0);
+            mask = &(fine_level->build_fine_mask());
         }
 
+        state_bytes += static_cast<Real>(grids[lev].numPts()) * sizeof(Real) *
+            (radial_mass_ncomp * ((alpha == 0.0 || alpha == 1.0) ? 1 : 2) + (mask ? 1 : 0));
+        copy_bytes += static_cast<Real>(grids[lev].numPts()) * sizeof(Real) *
+            (2 * NUM_STATE * ((alpha == 0.0 || alpha == 1.0) ? 1 : 2) + (mask ? 1 : 0));
+
         int n1d = radial_mass[lev].size();
 
 #ifdef GR_GRAV
@@ -3045,13 +3906,16 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
 #ifdef _OPENMP
             int tid = omp_get_thread_num();
 #endif
-            for (MFIter mfi(S, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
             {
                 const Box& bx = mfi.tilebox();
-                FArrayBox& fab = S[mfi];
 
                 compute_radial_mass(bx,
-                                    fab.array(),
+                                    S_old[mfi].const_array(),
+                                    S_new[mfi].const_array(),
+                                    alpha,
+                                    mask ? (*mask)[mfi].const_array() : Array4<Real const>(),
+                                    mask != nullptr,
 #ifdef _OPENMP
                                     priv_radial_mass[tid],
                                     priv_radial_vol[tid],
@@ -3282,8 +4146,12 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
         Lazy::QueueReduction( [=] () mutable {
 #endif
         ParallelDescriptor::ReduceRealMax(end,IOProc);
-        if (ParallelDescriptor::IOProcessor())
-            std::cout << "Gravity::make_radial_gravity() time = " << end << std::endl << std::endl;
+        if (ParallelDescriptor::IOProcessor()) {
+            std::cout << "Gravity::make_radial_gravity() time = " << end << std::endl;
+            std::cout << "Gravity::make_radial_gravity() state data read = " << state_bytes / 1.e6
+                      << " MB (a NUM_STATE copy would move at least " << copy_bytes / 1.e6
+                      << " MB)" << std::endl << std::endl;
+        }
 #ifdef BL_LAZY
         });
 #endif
@@ -3419,8 +4287,12 @@ Gravity::solve_phi_with_mlmg (int crse_level, int fine_level,
         }
 
 #if (AMREX_SPACEDIM == 3)
-        if ( gravity::direct_sum_bcs ) {
+        if ( gravity::fft_level0 ) {
+            fill_fft_level0(*rhs[0], *phi[0], true);
+        } else if ( gravity::direct_sum_bcs ) {
             fill_direct_sum_BCs(crse_level, fine_level, rhs, *phi[0]);
+        } else if ( gravity::tree_bcs ) {
+            fill_tree_BCs(crse_level, fine_level, rhs, *phi[0]);
         } else {
             fill_multipole_BCs(crse_level, fine_level, rhs, *phi[0]);
         }
@@ -3456,6 +4328,15 @@ Gravity::solve_phi_with_mlmg (int crse_level, int fine_level,
 
     Real abs_eps = abs_tol[fine_level] * max_rhs;
 
+    // With only level 0, the FFT potential can be used as is: an
+    // unreachable tolerance makes MLMG return after computing the
+    // initial residual, and then it only computes grad phi.
+
+    if (gravity::fft_level0 && gravity::fft_level0_skip_mlmg &&
+        crse_level == 0 && fine_level == 0 && !grad_phi.empty()) {
+        abs_eps = std::numeric_limits<Real>::max();
+    }
+
     Vector<const MultiFab*> crhs{rhs.begin(), rhs.end()};
     Vector<std::array<MultiFab*,AMREX_SPACEDIM> > gp;
     for (const auto& x : grad_phi) {
@@ -3511,24 +4392,52 @@ Gravity::actual_solve_with_mlmg (int crse_level, int fine_level,
 
     int nlevs = fine_level-crse_level+1;
 
-    Vector<Geometry> gmv;
-    Vector<BoxArray> bav;
-    Vector<DistributionMapping> dmv;
-    for (int ilev = 0; ilev < nlevs; ++ilev)
+    // Build the operator and solver, or reuse the ones from the last
+    // solve between these levels if the grids have not changed.
+
+    mlmg_cache_t& cache = mlmg_cache[std::make_pair(crse_level, fine_level)];
+
+    bool rebuild = gravity::mlmg_reuse_operator != 1 || !cache.mlmg;
+
+    for (int ilev = 0; ilev < nlevs && !rebuild; ++ilev)
     {
-        gmv.push_back(parent->Geom(ilev+crse_level));
-        bav.push_back(rhs[ilev]->boxArray());
-        dmv.push_back(rhs[ilev]->DistributionMap());
+        rebuild = cache.ba[ilev] != rhs[ilev]->boxArray() ||
+                  cache.dm[ilev] != rhs[ilev]->DistributionMap();
     }
 
-    LPInfo info;
-    info.setAgglomeration(gravity::mlmg_agglomeration);
-    info.setConsolidation(gravity::mlmg_consolidation);
+    if (rebuild)
+    {
+        const Real strt = ParallelDescriptor::second();
+
+        Vector<Geometry> gmv;
+        cache.ba.clear();
+        cache.dm.clear();
+        for (int ilev = 0; ilev < nlevs; ++ilev)
+        {
+            gmv.push_back(parent->Geom(ilev+crse_level));
+            cache.ba.push_back(rhs[ilev]->boxArray());
+            cache.dm.push_back(rhs[ilev]->DistributionMap());
+        }
+
+        LPInfo info;
+        info.setAgglomeration(gravity::mlmg_agglomeration);
+        info.setConsolidation(gravity::mlmg_consolidation);
+
+        // the solver holds a reference to the operator, so it goes first
+        cache.mlmg.reset();
+        cache.mlpoisson.reset(new MLPoisson(gmv, cache.ba, cache.dm, info));
+
+        // BC
+        cache.mlpoisson->setDomainBC(mlmg_lobc, mlmg_hibc);
+
+        cache.mlmg.reset(new MLMG(*cache.mlpoisson));
+
+        stats_setup_time += ParallelDescriptor::second() - strt;
+        stats_nsetup++;
+    }
 
-    MLPoisson mlpoisson(gmv, bav, dmv, info);
+    MLPoisson& mlpoisson = *cache.mlpoisson;
 
-    // BC
-    mlpoisson.setDomainBC(mlmg_lobc, mlmg_hibc);
     if (mlpoisson.needsCoarseDataForBC())
     {
         mlpoisson.setCoarseFineBC(crse_bcdata, parent->refRatio(crse_level-1)[0]);
@@ -3539,7 +4448,7 @@ Gravity::actual_solve_with_mlmg (int crse_level, int fine_level,
         mlpoisson.setLevelBC(ilev, phi[ilev]);
     }
 
-    MLMG mlmg(mlpoisson);
+    MLMG& mlmg = *cache.mlmg;
     mlmg.setVerbose(gravity::verbose - 1); // With normal verbosity we don't want MLMG information
     if (crse_level == 0) {
         mlmg.setMaxFmgIter(gravity::mlmg_max_fmg_iter);
@@ -3552,17 +4461,104 @@ Gravity::actual_solve_with_mlmg (int crse_level, int fine_level,
 
     if (!grad_phi.empty())
     {
-        if (!gmv[0].isAllPeriodic()) mlmg.setAlwaysUseBNorm(true);
+        if (!parent->Geom(crse_level).isAllPeriodic()) mlmg.setAlwaysUseBNorm(true);
 
         mlmg.setNSolve(gravity::mlmg_nsolve);
         final_resnorm = mlmg.solve(phi, rhs, rel_eps, abs_eps);
 
         mlmg.getGradSolution(grad_phi);
+
+        stats_nsolve++;
+        stats_ncycle += mlmg.getNumIters();
     }
     else if (!res.empty())
     {
         mlmg.compResidual(res, phi, rhs);
     }
 
+    if (gravity::mlmg_reuse_operator != 1)
+    {
+        mlmg_cache.erase(std::make_pair(crse_level, fine_level));
+    }
+
     return final_resnorm;
 }
+
+void
+Gravity::clear_mlmg_cache ()
+{
+    mlmg_cache.clear();
+}
+
+void
+Gravity::update_phi_rate (int level)
+{
+    BL_PROFILE("Gravity::update_phi_rate()");
+
+    if (gravity::gravity_type != "PoissonGrav" || gravity::extrapolate_phi_guess != 1) {
+        phi_rate[level].reset();
+        return;
+    }
+
+    const StateData& phi_state = LevelData[level]->get_state_data(PhiGrav_Type);
+
+    const Real dt = phi_state.curTime() - phi_state.prevTime();
+
+    if (!phi_state.hasOldData() || dt <= 0.0) {
+        phi_rate[level].reset();
+        return;
+    }
+
+    const MultiFab& phi_old = phi_state.oldData();
+    const MultiFab& phi_new = phi_state.newData();
+
+    if (!phi_rate[level] ||
+        phi_rate[level]->boxArray() != phi_new.boxArray() ||
+        phi_rate[level]->DistributionMap() != phi_new.DistributionMap()) {
+        phi_rate[level].reset(new MultiFab(phi_new.boxArray(), phi_new.DistributionMap(), 1, 0));
+    }
+
+    MultiFab::LinComb(*phi_rate[level], 1.0 / dt, phi_new, 0, -1.0 / dt, phi_old, 0, 0, 1, 0);
+}
+
+void
+Gravity::set_new_phi_guess (int level, MultiFab& phi_new)
+{
+    BL_PROFILE("Gravity::set_new_phi_guess()");
+
+    const StateData& phi_state = LevelData[level]->get_state_data(PhiGrav_Type);
+
+    MultiFab::Copy(phi_new, phi_state.oldData(), 0, 0, 1, phi_new.nGrow());
+
+    if (gravity::extrapolate_phi_guess == 1 && phi_rate[level] &&
+        phi_rate[level]->boxArray() == phi_new.boxArray() &&
+        phi_rate[level]->DistributionMap() == phi_new.DistributionMap()) {
+
+        const Real dt = phi_state.curTime() - phi_state.prevTime();
+
+        MultiFab::Saxpy(phi_new, dt, *phi_rate[level], 0, 0, 1, 0);
+    }
+}
+
+void
+Gravity::report_solve_stats ()
+{
+    Real times[2] = {stats_setup_time, stats_solve_time};
+
+    if (gravity::verbose > 0) {
+        ParallelDescriptor::ReduceRealMax(times, 2, ParallelDescriptor::IOProcessorNumber());
+    }
+
+    if (gravity::verbose > 0 && (stats_nsolve > 0 || stats_nsetup > 0)) {
+        amrex::Print() << "Gravity: " << stats_nsolve << " Poisson solves, "
+                       << (stats_nsolve > 0 ? static_cast<Real>(stats_ncycle) / stats_nsolve : 0.0)
+                       << " MLMG cycles per solve, " << stats_nsetup << " operator setups taking "
+                       << times[0] << " s, total gravity solve time " << times[1] << " s" << std::endl;
+    }
+
+    stats_nsolve = 0;
+    stats_ncycle = 0;
+    stats_nsetup = 0;
+    stats_setup_time = 0.0;
+    stats_solve_time = 0.0;
+}
@@ -0,0 +1,319 @@
+#include <AMReX_ParallelDescriptor.H>
+
+#include <fft_poisson.H>
+
+#include <fundamental_constants.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+#if (AMREX_SPACEDIM == 3)
+
+// An in-place radix-2 FFT of the complex line (components 0 and 1)
+// through (i, j, k) in direction dir, of length n.  tw holds cos and
+// sin of 2 pi m / n for m < n / 2; sign is -1 for the forward
+// transform and +1 for the (unnormalized) inverse.
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void fft_line (Array4<Real> const& a, int i, int j, int k, int dir, int n,
+               const Real* tw, int sign)
+{
+    Real* re = a.ptr(i, j, k, 0);
+    Real* im = a.ptr(i, j, k, 1);
+    const Long s = dir == 0 ? 1 : (dir == 1 ? a.jstride : a.kstride);
+
+    // bit-reversal permutation
+
+    for (int p = 1, q = 0; p < n; ++p) {
+        int bit = n >> 1;
+        for (; q & bit; bit >>= 1) {
+            q ^= bit;
+        }
+        q ^= bit;
+
+        if (p < q) {
+            Real t = re[p*s];
+            re[p*s] = re[q*s];
+            re[q*s] = t;
+
+            t = im[p*s];
+            im[p*s] = im[q*s];
+            im[q*s] = t;
+        }
+    }
+
+    // butterflies
+
+    for (int len = 2; len <= n; len <<= 1) {
+        const int half = len >> 1;
+        const int tstep = n / len;
+
+        for (int b = 0; b < n; b += len) {
+            for (int m = 0; m < half; ++m) {
+                const Real wr = tw[2*m*tstep];
+                const Real wi = sign * tw[2*m*tstep+1];
+
+                const Long p = (b + m) * s;
+                const Long q = (b + m + half) * s;
+
+                const Real vr = re[q] * wr - im[q] * wi;
+                const Real vi = re[q] * wi + im[q] * wr;
+
+                re[q] = re[p] - vr;
+                im[q] = im[p] - vi;
+                re[p] += vr;
+                im[p] += vi;
+            }
+        }
+    }
+}
+
+// The integral of 1 / r over a box of sides dx centered on the origin,
+// from the antiderivative
+//
+//   F = yz ln(x + r) + xz ln(y + r) + xy ln(z + r)
+//       - x^2/2 atan(yz / (xr)) - y^2/2 atan(xz / (yr)) - z^2/2 atan(xy / (zr))
+//
+// evaluated at the corners.  For a cube of side a this is 2.38008 a^2.
+
+static Real
+cell_inverse_r_integral (const GpuArray<Real, AMREX_SPACEDIM>& dx)
+{
+    auto F = [] (Real x, Real y, Real z) -> Real
+    {
+        Real r = std::sqrt(x * x + y * y + z * z);
+        return y * z * std::log(x + r) + x * z * std::log(y + r) + x * y * std::log(z + r)
+            - 0.5_rt * x * x * std::atan(y * z / (x * r))
+            - 0.5_rt * y * y * std::atan(x * z / (y * r))
+            - 0.5_rt * z * z * std::atan(x * y / (z * r));
+    };
+
+    Real sum = 0.0_rt;
+
+    for (int c = 0; c < 8; ++c) {
+        Real sx = (c & 1) ? 1.0_rt : -1.0_rt;
+        Real sy = (c & 2) ? 1.0_rt : -1.0_rt;
+        Real sz = (c & 4) ? 1.0_rt : -1.0_rt;
+
+        sum += sx * sy * sz * F(0.5_rt * sx * dx[0], 0.5_rt * sy * dx[1], 0.5_rt * sz * dx[2]);
+    }
+
+    return sum;
+}
+
+FFTPoisson::FFTPoisson (const Geometry& a_geom)
+    : geom(a_geom)
+{
+    BL_PROFILE("FFTPoisson::FFTPoisson()");
+
+    AMREX_ALWAYS_ASSERT(AMREX_SPACEDIM == 3 && geom.IsCartesian());
+
+    const Box& domain = geom.Domain();
+
+    // The padded domain must be at least twice the domain in each
+    // direction; then the offsets between a source cell and a target
+    // cell in the domain or its first ghost layer, which are within
+    // +/- n, do not alias, and the Green's function is the same at +n
+    // and -n.
+
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        int n = 1;
+        int l = 0;
+        while (n < 2 * domain.length(d)) {
+            n *= 2;
+            ++l;
+        }
+        n_pad[d] = n;
+        log2_n_pad[d] = l;
+    }
+
+    pad_box = Box(domain.smallEnd() - 1, domain.smallEnd() - 1 + n_pad - 1);
+
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+
+        // about four pencils per rank
+
+        const int d1 = (d + 1) % AMREX_SPACEDIM;
+        const int d2 = (d + 2) % AMREX_SPACEDIM;
+
+        const Real area = static_cast<Real>(n_pad[d1]) * static_cast<Real>(n_pad[d2]);
+        const int w = amrex::max(1, static_cast<int>(std::sqrt(area / (4.0_rt * nprocs))));
+
+        IntVect chunk(AMREX_D_DECL(w, w, w));
+        chunk[d] = n_pad[d];
+
+        pencil_ba[d] = BoxArray(pad_box);
+        pencil_ba[d].maxSize(chunk);
+        pencil_dm[d] = DistributionMapping(pencil_ba[d]);
+
+        const int n = n_pad[d];
+
+        Vector<Real> tw(n);
+        for (int m = 0; m < n / 2; ++m) {
+            tw[2*m  ] = std::cos(2.0_rt * M_PI * m / n);
+            tw[2*m+1] = std::sin(2.0_rt * M_PI * m / n);
+        }
+
+        twiddle[d].resize(n);
+        Gpu::copy(Gpu::hostToDevice, tw.begin(), tw.end(), twiddle[d].begin());
+    }
+
+    // The Green's function on the padded domain, with the offsets
+    // wrapped into [-n/2, n/2].  Each cell is a point mass, except
+    // for the cell itself, where we use the exact potential at the
+    // center of a uniform box.
+
+    const auto dx = geom.CellSizeArray();
+    const Real vol = AMREX_D_TERM(dx[0], * dx[1], * dx[2]);
+    const Real self = -C::Gconst * cell_inverse_r_integral(dx);
+
+    const IntVect plo = pad_box.smallEnd();
+    const IntVect np = n_pad;
+
+    MultiFab x(pencil_ba[0], pencil_dm[0], 2, 0);
+    MultiFab y(pencil_ba[1], pencil_dm[1], 2, 0);
+    MultiFab z(pencil_ba[2], pencil_dm[2], 2, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(x, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto g = x.array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            const int idx[3] = {i, j, k};
+
+            Real r2 = 0.0_rt;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                int o = idx[d] - plo[d];
+                if (o > np[d] / 2) {
+                    o -= np[d];
+                }
+                r2 += (o * dx[d]) * (o * dx[d]);
+            }
+
+            g(i,j,k,0) = r2 == 0.0_rt ? self : -C::Gconst * vol / std::sqrt(r2);
+            g(i,j,k,1) = 0.0_rt;
+        });
+    }
+
+    forward(x, y, z);
+
+    // G is real and even, so its transform is real
+
+    green_hat.reset(new MultiFab(pencil_ba[2], pencil_dm[2], 1, 0));
+
+    const Real norm = 1.0_rt / (static_cast<Real>(np[0]) * static_cast<Real>(np[1]) * static_cast<Real>(np[2]));
+
+    MultiFab::Copy(*green_hat, z, 0, 0, 1, 0);
+    green_hat->mult(norm);
+}
+
+Long
+FFTPoisson::bytes () const
+{
+    // the three complex pencil layouts and the Green's function
+    return 7 * pad_box.numPts() * static_cast<Long>(sizeof(Real));
+}
+
+void
+FFTPoisson::transform (MultiFab& mf, int dir, int sign)
+{
+    BL_PROFILE("FFTPoisson::transform()");
+
+    const int n = n_pad[dir];
+    const Real* tw = twiddle[dir].data();
+
+    // each pencil covers the whole padded domain in dir, so this is
+    // one transform per line through the low face of the pencil
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        Box lines = mfi.validbox();
+        lines.setBig(dir, lines.smallEnd(dir));
+
+        auto a = mf.array(mfi);
+
+        amrex::ParallelFor(lines,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            fft_line(a, i, j, k, dir, n, tw, sign);
+        });
+    }
+}
+
+void
+FFTPoisson::forward (MultiFab& x, MultiFab& y, MultiFab& z)
+{
+    transform(x, 0, -1);
+    y.ParallelCopy(x, 0, 0, 2);
+    transform(y, 1, -1);
+    z.ParallelCopy(y, 0, 0, 2);
+    transform(z, 2, -1);
+}
+
+void
+FFTPoisson::backward (MultiFab& x, MultiFab& y, MultiFab& z)
+{
+    transform(z, 2, 1);
+    y.ParallelCopy(z, 0, 0, 2);
+    transform(y, 1, 1);
+    x.ParallelCopy(y, 0, 0, 2);
+    transform(x, 0, 1);
+}
+
+void
+FFTPoisson::solve (const MultiFab& rho, MultiFab& phi)
+{
+    BL_PROFILE("FFTPoisson::solve()");
+
+    AMREX_ALWAYS_ASSERT(phi.nGrow() >= 1);
+
+    MultiFab x(pencil_ba[0], pencil_dm[0], 2, 0);
+    MultiFab y(pencil_ba[1], pencil_dm[1], 2, 0);
+    MultiFab z(pencil_ba[2], pencil_dm[2], 2, 0);
+
+    // the density, zero in the padding
+
+    x.setVal(0.0);
+    x.ParallelCopy(rho, 0, 0, 1);
+
+    forward(x, y, z);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(z, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto a = z.array(mfi);
+        auto g = green_hat->const_array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            a(i,j,k,0) *= g(i,j,k);
+            a(i,j,k,1) *= g(i,j,k);
+        });
+    }
+
+    backward(x, y, z);
+
+    // Only the domain and its first ghost layer hold the isolated
+    // potential; further out the padding wraps around.
+
+    phi.ParallelCopy(x, 0, 0, 1, 0, 1);
+}
+#endif
@@ -129,6 +129,13 @@ Castro::construct_ctu_hydro_source(Real time, Real dt)
 
     for (MFIter mfi(S_new, hydro_tile_size); mfi.isValid(); ++mfi) {
 
+      // During a localized retry, boxes away from the failing zones
+      // keep their first-attempt update and are not advanced here.
+
+      if (!retry_box_is_active(mfi.index())) {
+          continue;
+      }
+
       size_t fab_size = 0;
 
       // the valid region box
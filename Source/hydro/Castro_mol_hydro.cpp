@@ -79,8 +79,9 @@ Castro::construct_mol_hydro_source(Real time, Real dt, MultiFab& A_update)
 
     MultiFab& old_source = get_old_data(Source_Type);
 
-    // The fourth order stuff cannot do tiling because of the Laplacian corrections
-    for (MFIter mfi(S_new, (sdc_order == 4) ? no_tile_size : hydro_tile_size); mfi.isValid(); ++mfi)
+    // The fourth order Laplacian corrections only read the shared q and work on
+    // per-tile temporaries grown by one zone, so they can be tiled as well
+    for (MFIter mfi(S_new, hydro_tile_size); mfi.isValid(); ++mfi)
       {
         const Box& bx  = mfi.tilebox();
 
@@ -101,9 +102,11 @@ Castro::construct_mol_hydro_source(Real time, Real dt, MultiFab& A_update)
 
         Real stage_weight = 1.0;
 
+#ifdef TRUE_SDC
         if (time_integration_method == SpectralDeferredCorrections) {
-          stage_weight = node_weights[current_sdc_node];
+          stage_weight = sdc_flux_weight(current_sdc_node);
         }
+#endif
 
         // get the flattening coefficient
         flatn.resize(obx, 1);
@@ -698,14 +701,15 @@ Castro::construct_mol_hydro_source(Real time, Real dt, MultiFab& A_update)
         }
 
 
-        // Store the fluxes from this advance -- we weight them by the
-        // integrator weight for this stage
+        // Store the fluxes from this advance -- we weight them so that,
+        // summed over the nodes and iterations, they give the flux
+        // that was actually applied to the state over the step, which
+        // is what the reflux needs.
 
-        // For SDC, we store node 0 the only time we enter here (the
-        // first iteration) and we store the other nodes only on the
-        // last iteration.
-        if (time_integration_method == SpectralDeferredCorrections &&
-             (current_sdc_node == 0 || sdc_iteration == sdc_order+sdc_extra-1)) {
+        // For SDC, node 0 is stored the only time we enter here (the
+        // first iteration) and the other nodes are stored on the last
+        // two iterations (see sdc_flux_weight).
+        if (time_integration_method == SpectralDeferredCorrections && stage_weight != 0.0) {
 
           for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
 
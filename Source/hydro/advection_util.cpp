@@ -19,6 +19,7 @@
 #endif
 
 #include <eos.H>
+#include <eos_table.H>
 
 using namespace amrex;
 
@@ -144,7 +145,7 @@ Castro::ctoprim(const Box& bx,
     }
 #endif
 
-    eos(eos_input_re, eos_state);
+    hydro_eos_re(eos_state);
 
     q_arr(i,j,k,QTEMP) = eos_state.T;
     q_arr(i,j,k,QREINT) = eos_state.e * q_arr(i,j,k,QRHO);
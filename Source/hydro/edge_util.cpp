@@ -1,5 +1,6 @@
 #include <Castro.H>
 #include <Castro_hydro.H>
+#include <eos_table.H>
 
 using namespace amrex;
 
@@ -59,7 +60,7 @@ Castro::reset_edge_state_thermo(const Box& bx,
             }
 #endif
 
-            eos(eos_input_re, eos_state);
+            hydro_eos_re(eos_state);
 
             qedge(i,j,k,QREINT) = eos_state.e * eos_state.rho;
             qedge(i,j,k,QPRES) = amrex::max(eos_state.p, small_p);
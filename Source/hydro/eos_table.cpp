@@ -0,0 +1,369 @@
+#include <AMReX_Arena.H>
+#include <AMReX_Gpu.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Print.H>
+
+#include <string>
+
+#include <eos_table.H>
+
+using namespace amrex;
+
+AMREX_GPU_MANAGED eos_table::table_t eos_table::table;
+
+// Set the composition of an EOS state from abar and Y_e directly --
+// the table is not tied to any one mixture of the network's species,
+// so we skip the composition step of eos() and call actual_eos().
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void set_table_composition (eos_t& state, const Real abar, const Real ye)
+{
+    state.abar = abar;
+    state.zbar = ye * abar;
+    state.y_e = ye;
+    state.mu_e = 1.0_rt / ye;
+    state.mu = abar / (1.0_rt + state.zbar);
+    for (int n = 0; n < NumSpec; n++) {
+        state.xn[n] = 1.0_rt / NumSpec;
+    }
+}
+
+// Find T such that e(rho, T) = e, bracketed in [T_lo, T_hi], with a
+// Newton iteration in ln T that falls back to bisection.  On success,
+// state holds the EOS evaluated at the solution.  Returns false if e is
+// outside the range of the EOS at this density or the iteration did not
+// converge.
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+bool invert_re (const Real rho, const Real e, const Real abar, const Real ye,
+                const Real T_lo, const Real T_hi, eos_t& state)
+{
+    set_table_composition(state, abar, ye);
+    state.rho = rho;
+
+    Real lT_lo = std::log(T_lo);
+    Real lT_hi = std::log(T_hi);
+
+    state.T = T_lo;
+    actual_eos(eos_input_rt, state);
+    if (state.e > e) {
+        return false;
+    }
+
+    state.T = T_hi;
+    actual_eos(eos_input_rt, state);
+    if (state.e < e) {
+        return false;
+    }
+
+    Real lT = 0.5_rt * (lT_lo + lT_hi);
+    bool converged = false;
+
+    for (int iter = 0; iter < 100 && !converged; iter++) {
+
+        state.T = std::exp(lT);
+        actual_eos(eos_input_rt, state);
+
+        Real f = state.e - e;
+
+        if (f > 0.0_rt) {
+            lT_hi = lT;
+        } else {
+            lT_lo = lT;
+        }
+
+        // de/d ln T = T de/dT
+        Real lT_new = lT - f / (state.T * state.dedT);
+
+        if (!(lT_new > lT_lo && lT_new < lT_hi)) {
+            lT_new = 0.5_rt * (lT_lo + lT_hi);
+        }
+
+        if (std::abs(lT_new - lT) < 1.e-12_rt) {
+            converged = true;
+        }
+
+        lT = lT_new;
+    }
+
+    state.T = std::exp(lT);
+    actual_eos(eos_input_rt, state);
+
+    return converged;
+}
+
+// The table treats the EOS as a function of (rho, T, abar, Y_e) only.
+// Check that for each single-species composition and for the equal
+// mixture, at a few (rho, T) points, the full eos() with the actual mass
+// fractions agrees with actual_eos() on the composition used to build
+// the table. An EOS that depends on the individual mass fractions (for
+// example multigamma) fails this, and cannot use the table.
+
+static void
+check_composition_dependence (const Real T_lo, const Real T_hi)
+{
+    const Real lrho_lo = std::log(castro::eos_table_dens_min);
+    const Real lrho_hi = std::log(castro::eos_table_dens_max);
+    const Real lT_lo = std::log(T_lo);
+    const Real lT_hi = std::log(T_hi);
+
+    const Real frac[3] = {0.25_rt, 0.5_rt, 0.75_rt};
+
+    Real max_err = 0.0_rt;
+
+    for (int c = 0; c <= NumSpec; c++) {
+
+        eos_t full;
+
+        Real sum_a = 0.0_rt;
+        Real sum_z = 0.0_rt;
+        for (int n = 0; n < NumSpec; n++) {
+            full.xn[n] = c < NumSpec ? (n == c ? 1.0_rt : 0.0_rt) : 1.0_rt / NumSpec;
+            sum_a += full.xn[n] * aion_inv[n];
+            sum_z += full.xn[n] * zion[n] * aion_inv[n];
+        }
+
+        for (int ir = 0; ir < 3; ir++) {
+            for (int iT = 0; iT < 3; iT++) {
+
+                full.rho = std::exp(lrho_lo + frac[ir] * (lrho_hi - lrho_lo));
+                full.T = std::exp(lT_lo + frac[iT] * (lT_hi - lT_lo));
+
+                eos(eos_input_rt, full);
+
+                eos_t tab_state;
+                set_table_composition(tab_state, 1.0_rt / sum_a, sum_z);
+                tab_state.rho = full.rho;
+                tab_state.T = full.T;
+
+                actual_eos(eos_input_rt, tab_state);
+
+                max_err = amrex::max(max_err, std::abs(tab_state.e - full.e) / std::abs(full.e));
+                max_err = amrex::max(max_err, std::abs(tab_state.p - full.p) / std::abs(full.p));
+                max_err = amrex::max(max_err, std::abs(tab_state.gam1 - full.gam1) / std::abs(full.gam1));
+            }
+        }
+    }
+
+    if (!(max_err <= 1.e-2_rt * castro::eos_table_tol)) {
+        amrex::Error("castro.use_eos_table = 1 needs an EOS that depends on the composition only "
+                     "through abar and zbar, but this EOS changes by a relative " +
+                     std::to_string(max_err) + " between mixtures with the same abar and Y_e");
+    }
+}
+
+void
+eos_table::init ()
+{
+    BL_PROFILE("eos_table::init()");
+
+#if NAUX_NET > 0 || defined(AUX_THERMO)
+    // The table is keyed on the mass fractions only, so it cannot be
+    // used with auxiliary composition variables; hydro_eos_re always
+    // calls the full EOS in this case.
+
+    amrex::Print() << "EOS table: not used with auxiliary composition variables; "
+                   << "castro.use_eos_table is ignored" << std::endl;
+    return;
+#endif
+
+    table_t& tab = table;
+
+    const int n_in[ndim] = {castro::eos_table_ndens, castro::eos_table_neint,
+                            castro::eos_table_nabar, castro::eos_table_nye};
+
+    const Real lo_in[ndim] = {std::log(castro::eos_table_dens_min), std::log(castro::eos_table_eint_min),
+                              std::log(castro::eos_table_abar_min), castro::eos_table_ye_min};
+
+    const Real hi_in[ndim] = {std::log(castro::eos_table_dens_max), std::log(castro::eos_table_eint_max),
+                              std::log(castro::eos_table_abar_max), castro::eos_table_ye_max};
+
+    const char* axis_name[ndim] = {"dens", "eint", "abar", "ye"};
+
+    Long nnodes = 1;
+    Long ncells = 1;
+
+    for (int d = 0; d < ndim; d++) {
+        if (n_in[d] < 1 || (n_in[d] == 1 && hi_in[d] != lo_in[d]) ||
+            (n_in[d] > 1 && !(hi_in[d] > lo_in[d]))) {
+            amrex::Error("invalid EOS table range for " + std::string(axis_name[d]) +
+                         ": need n > 1 and min < max, or n = 1 and min = max");
+        }
+
+        tab.n[d] = n_in[d];
+        tab.lo[d] = lo_in[d];
+        tab.dx[d] = n_in[d] > 1 ? (hi_in[d] - lo_in[d]) / (n_in[d] - 1) : 0.0_rt;
+        tab.dxinv[d] = n_in[d] > 1 ? 1.0_rt / tab.dx[d] : 0.0_rt;
+
+        nnodes *= n_in[d];
+        ncells *= amrex::max(n_in[d] - 1, 1);
+    }
+
+    tab.data = static_cast<Real*>(The_Arena()->alloc(nnodes * nvars * sizeof(Real)));
+    tab.valid = static_cast<unsigned char*>(The_Arena()->alloc(ncells * sizeof(unsigned char)));
+
+    Gpu::DeviceVector<unsigned char> node_ok_v(nnodes);
+    unsigned char* node_ok = node_ok_v.data();
+
+    const Real T_lo = amrex::max(castro::small_temp, EOSData::mintemp);
+    const Real T_hi = EOSData::maxtemp;
+
+    check_composition_dependence(T_lo, T_hi);
+
+    const table_t t = tab;
+
+    // the nodes
+
+    amrex::ParallelFor(nnodes,
+    [=] AMREX_GPU_HOST_DEVICE (Long node)
+    {
+        Real x[ndim];
+        Long r = node;
+        for (int d = 0; d < ndim; d++) {
+            x[d] = t.lo[d] + static_cast<Real>(r % t.n[d]) * t.dx[d];
+            r /= t.n[d];
+        }
+
+        eos_t state;
+        bool ok = invert_re(std::exp(x[idens]), std::exp(x[ieint]), std::exp(x[iabar]), x[iye],
+                            T_lo, T_hi, state);
+
+        ok = ok && state.p > 0.0_rt && state.gam1 > 0.0_rt;
+
+        t.data[node * nvars + ilogT] = ok ? std::log(state.T) : 0.0_rt;
+        t.data[node * nvars + ilogp] = ok ? std::log(state.p) : 0.0_rt;
+        t.data[node * nvars + igam1] = ok ? state.gam1 : 0.0_rt;
+
+        node_ok[node] = ok ? 1 : 0;
+    });
+
+    // check each cell at its center, where the interpolated value is the
+    // average of the corners, against the full EOS. This samples the
+    // interpolation error at one point per cell; it is not a bound on the
+    // error everywhere in the cell.
+
+    const Real tol = castro::eos_table_tol;
+
+    ReduceOps<ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpSum> reduce_op;
+    ReduceData<Real, Real, Real, Real, Long> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    reduce_op.eval(ncells, reduce_data,
+    [=] AMREX_GPU_HOST_DEVICE (Long cell) -> ReduceTuple
+    {
+        int idx[ndim];
+        Long stride[ndim];
+        Real x[ndim];
+
+        Long r = cell;
+        Long s = 1;
+        for (int d = 0; d < ndim; d++) {
+            int nc = amrex::max(t.n[d] - 1, 1);
+            idx[d] = static_cast<int>(r % nc);
+            r /= nc;
+            stride[d] = t.n[d] > 1 ? s : 0;
+            s *= t.n[d];
+            x[d] = t.lo[d] + (static_cast<Real>(idx[d]) + (t.n[d] > 1 ? 0.5_rt : 0.0_rt)) * t.dx[d];
+        }
+
+        Long base = 0;
+        for (int d = 0; d < ndim; d++) {
+            base += idx[d] * stride[d];
+        }
+
+        bool ok = true;
+        Real v[nvars] = {0.0_rt};
+        int ncorner = 0;
+
+        for (int corner = 0; corner < (1 << ndim); corner++) {
+            Long node = base;
+            bool distinct = true;
+            for (int d = 0; d < ndim; d++) {
+                if (corner & (1 << d)) {
+                    if (stride[d] == 0) {
+                        distinct = false;
+                    }
+                    node += stride[d];
+                }
+            }
+            if (!distinct) {
+                continue;
+            }
+            ok = ok && node_ok[node] == 1;
+            for (int m = 0; m < nvars; m++) {
+                v[m] += t.data[node * nvars + m];
+            }
+            ncorner++;
+        }
+
+        Real err_T = 0.0_rt;
+        Real err_p = 0.0_rt;
+        Real err_gam1 = 0.0_rt;
+        Real err_cs = 0.0_rt;
+
+        if (ok) {
+            const Real rho = std::exp(x[idens]);
+
+            eos_t state;
+            ok = invert_re(rho, std::exp(x[ieint]), std::exp(x[iabar]), x[iye],
+                           T_lo, T_hi, state);
+
+            if (ok) {
+                Real T = std::exp(v[ilogT] / ncorner);
+                Real p = std::exp(v[ilogp] / ncorner);
+                Real gam1 = v[igam1] / ncorner;
+                Real cs = std::sqrt(gam1 * p / rho);
+
+                err_T = std::abs(T - state.T) / state.T;
+                err_p = std::abs(p - state.p) / state.p;
+                err_gam1 = std::abs(gam1 - state.gam1) / state.gam1;
+                err_cs = std::abs(cs - state.cs) / state.cs;
+
+                ok = err_T <= tol && err_p <= tol && err_gam1 <= tol && err_cs <= tol;
+            }
+        }
+
+        t.valid[cell] = ok ? 1 : 0;
+
+        if (!ok) {
+            return {0.0_rt, 0.0_rt, 0.0_rt, 0.0_rt, 0};
+        }
+
+        return {err_T, err_p, err_gam1, err_cs, 1};
+    });
+
+    ReduceTuple hv = reduce_data.value();
+
+    tab.initialized = true;
+
+    if (castro::verbose > 0) {
+        Long nvalid = amrex::get<4>(hv);
+
+        amrex::Print() << "EOS table: " << tab.n[idens] << " x " << tab.n[ieint] << " x "
+                       << tab.n[iabar] << " x " << tab.n[iye] << " nodes, "
+                       << nvalid << " of " << ncells << " cells ("
+                       << 100.0_rt * static_cast<Real>(nvalid) / static_cast<Real>(ncells)
+                       << "%) within castro.eos_table_tol = " << tol << std::endl;
+        amrex::Print() << "   maximum relative error sampled at the cell centers: T "
+                       << amrex::get<0>(hv) << ", p " << amrex::get<1>(hv)
+                       << ", Gamma_1 " << amrex::get<2>(hv)
+                       << ", c_s " << amrex::get<3>(hv) << std::endl;
+    }
+}
+
+void
+eos_table::finalize ()
+{
+    table_t& tab = table;
+
+    if (!tab.initialized) {
+        return;
+    }
+
+    The_Arena()->free(tab.data);
+    The_Arena()->free(tab.valid);
+
+    tab.data = nullptr;
+    tab.valid = nullptr;
+    tab.initialized = false;
+}
@@ -2,69 +2,46 @@
 #include <Castro_F.H>
 
 #include <riemann_solvers.H>
+#include <riemann_dispatch.H>
 
 #ifdef RADIATION
 #include <Radiation.H>
 #endif
 
+#include <array>
 #include <cmath>
+#include <utility>
 
 #include <eos.H>
 using namespace amrex;
 
-void
-Castro::cmpflx_plus_godunov(const Box& bx,
-                            Array4<Real> const& qm,
-                            Array4<Real> const& qp,
-                            Array4<Real> const& flx,
-#ifdef RADIATION
-                            Array4<Real> const& rflx,
-#endif
-                            Array4<Real> const& qgdnv,
-                            Array4<Real const> const& qaux_arr,
-                            Array4<Real const> const& shk,
-                            const int idir, const bool store_full_state) {
+// The Riemann solve over a box of interfaces.  The options are
+// template parameters, so each combination gets its own face loop
+// with the choices made at compile time.
 
-    // note: bx is not necessarily the limits of the valid (no ghost
-    // cells) domain, but could be hi+1 in some dimensions.  We rely on
-    // the caller to specify the interfaces over which to solve the
-    // Riemann problems
-
-    // Solve Riemann problem to get the fluxes
-
-    // store_full_state determines what is put into qgdnv.  if
-    // store_full_state is True, we put all NQ variables into the
-    // qgdnv.  if store_full_state is False, we only store the NGDNV
-    // needed elsewhere in the algorithm.
-
-
-    // Note: because the NQ variables do not include lambda and the
-    // NGDNV do, we only support store_full_state = false for
-    // Radiation
+template <int solver, bool eos_on_interface, bool hybrid, bool store_full_state>
+void
+riemann_faces_kernel(const RiemannFaceArgs& args)
+{
 
+    const auto qm = args.qm;
+    const auto qp = args.qp;
+    const auto flx = args.flx;
 #ifdef RADIATION
-    if (store_full_state == true) {
-        amrex::Error("cannot store full interface state with radiation");
-    }
+    const auto rflx = args.rflx;
 #endif
+    const auto qgdnv = args.qgdnv;
+    const auto qaux_arr = args.qaux;
+    const auto shk = args.shk;
 
-    const int* lo_bc = phys_bc.lo();
-    const int* hi_bc = phys_bc.hi();
-
-    // do we want to force the flux to zero at the boundary?
-    const bool special_bnd_lo = (lo_bc[idir] == Symmetry ||
-                                 lo_bc[idir] == SlipWall ||
-                                 lo_bc[idir] == NoSlipWall);
-    const bool special_bnd_hi = (hi_bc[idir] == Symmetry ||
-                                 hi_bc[idir] == SlipWall ||
-                                 hi_bc[idir] == NoSlipWall);
-
-    auto coord = geom.Coord();
-
-    GeometryData geomdata = geom.data();
+    const int idir = args.idir;
+    const GeometryData geomdata = args.geomdata;
+    const int coord = geomdata.Coord();
 
-    const auto domlo = geom.Domain().loVect3d();
-    const auto domhi = geom.Domain().hiVect3d();
+    const bool special_bnd_lo = args.special_bnd_lo;
+    const bool special_bnd_hi = args.special_bnd_hi;
+    const auto domlo = args.domlo;
+    const auto domhi = args.domhi;
 
 #ifdef RADIATION
     int fspace_t = Radiation::fspace_advection_type;
@@ -73,24 +50,24 @@ Castro::cmpflx_plus_godunov(const Box& bx,
     int closure = Radiation::closure;
 #endif
 
-    amrex::ParallelFor(bx,
+    amrex::ParallelFor(args.bx,
     [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
     {
 
 
-        if (riemann_solver == 0 || riemann_solver == 1) {
+        if constexpr (solver == 0 || solver == 1) {
             // approximate state Riemann solvers
 
             // first find the interface state on the current interface
 
             RiemannState qint;
 
-            riemann_state(i, j, k, idir,
-                          qm, qp, qaux_arr,
-                          qint,
-                          geomdata,
-                          special_bnd_lo, special_bnd_hi,
-                          domlo, domhi);
+            riemann_state<solver, eos_on_interface>(i, j, k, idir,
+                                                    qm, qp, qaux_arr,
+                                                    qint,
+                                                    geomdata,
+                                                    special_bnd_lo, special_bnd_hi,
+                                                    domlo, domhi);
 
             // now use the interface state to compute and store the flux
 
@@ -125,12 +102,12 @@ Castro::cmpflx_plus_godunov(const Box& bx,
 
                 flx(i,j,k,n) = flx(i,j,k,URHO) * X_int;
 
-                if (store_full_state) {
+                if constexpr (store_full_state) {
                     qgdnv(i,j,k,nqp) = X_int;
                 }
             }
 
-        } else if (riemann_solver == 2) {
+        } else {
             // HLLC
             HLLC(i, j, k, idir,
                  qm, qp,
@@ -140,14 +117,9 @@ Castro::cmpflx_plus_godunov(const Box& bx,
                  geomdata,
                  special_bnd_lo, special_bnd_hi,
                  domlo, domhi);
-
-#ifndef AMREX_USE_GPU
-        } else {
-            amrex::Error("ERROR: invalid value of riemann_solver");
-#endif
         }
 
-        if (hybrid_riemann == 1) {
+        if constexpr (hybrid) {
             // correct the fluxes using an HLL scheme if we are in a shock
             // and doing the hybrid approach
 
@@ -155,7 +127,7 @@ Castro::cmpflx_plus_godunov(const Box& bx,
 
             if (idir == 0) {
                 is_shock = static_cast<int>(shk(i-1,j,k) + shk(i,j,k));
-            } else if (idir == 1) { 
+            } else if (idir == 1) {
                 is_shock = static_cast<int>(shk(i,j-1,k) + shk(i,j,k));
             } else {
                 is_shock = static_cast<int>(shk(i,j,k-1) + shk(i,j,k));
@@ -168,7 +140,7 @@ Castro::cmpflx_plus_godunov(const Box& bx,
                 if (idir == 0) {
                     cl = qaux_arr(i-1,j,k,QC);
                     cr = qaux_arr(i,j,k,QC);
-                } else if (idir == 1) { 
+                } else if (idir == 1) {
                     cl = qaux_arr(i,j-1,k,QC);
                     cr = qaux_arr(i,j,k,QC);
                 } else {
@@ -206,3 +178,118 @@ Castro::cmpflx_plus_godunov(const Box& bx,
 }
 
 
+// The table of face loops, one for each combination of the solver
+// (0, 1, 2) and the three boolean options, indexed by
+// riemann_faces_index().
+
+using riemann_faces_t = void (*)(const RiemannFaceArgs&);
+
+constexpr int riemann_num_solvers = 3;
+
+static constexpr int
+riemann_faces_index (const int solver, const bool eos_on_interface,
+                     const bool hybrid, const bool store_full_state)
+{
+    return ((solver * 2 + static_cast<int>(eos_on_interface)) * 2 +
+            static_cast<int>(hybrid)) * 2 + static_cast<int>(store_full_state);
+}
+
+template <std::size_t... I>
+static constexpr std::array<riemann_faces_t, sizeof...(I)>
+make_riemann_faces_table (std::index_sequence<I...>)
+{
+    return {{&riemann_faces_kernel<static_cast<int>(I / 8), (I / 4) % 2 == 1,
+                                   (I / 2) % 2 == 1, I % 2 == 1>...}};
+}
+
+static constexpr auto riemann_faces_table =
+    make_riemann_faces_table(std::make_index_sequence<8 * riemann_num_solvers>{});
+
+
+void
+riemann_faces(const RiemannFaceArgs& args,
+              const int solver, const bool eos_on_interface,
+              const bool hybrid, const bool store_full_state)
+{
+
+    if (solver < 0 || solver >= riemann_num_solvers) {
+        amrex::Error("ERROR: invalid value of riemann_solver");
+    }
+
+    riemann_faces_table[riemann_faces_index(solver, eos_on_interface,
+                                            hybrid, store_full_state)](args);
+
+}
+
+
+void
+Castro::cmpflx_plus_godunov(const Box& bx,
+                            Array4<Real> const& qm,
+                            Array4<Real> const& qp,
+                            Array4<Real> const& flx,
+#ifdef RADIATION
+                            Array4<Real> const& rflx,
+#endif
+                            Array4<Real> const& qgdnv,
+                            Array4<Real const> const& qaux_arr,
+                            Array4<Real const> const& shk,
+                            const int idir, const bool store_full_state) {
+
+    // note: bx is not necessarily the limits of the valid (no ghost
+    // cells) domain, but could be hi+1 in some dimensions.  We rely on
+    // the caller to specify the interfaces over which to solve the
+    // Riemann problems
+
+    // Solve Riemann problem to get the fluxes
+
+    // store_full_state determines what is put into qgdnv.  if
+    // store_full_state is True, we put all NQ variables into the
+    // qgdnv.  if store_full_state is False, we only store the NGDNV
+    // needed elsewhere in the algorithm.
+
+
+    // Note: because the NQ variables do not include lambda and the
+    // NGDNV do, we only support store_full_state = false for
+    // Radiation
+
+#ifdef RADIATION
+    if (store_full_state == true) {
+        amrex::Error("cannot store full interface state with radiation");
+    }
+#endif
+
+    const int* lo_bc = phys_bc.lo();
+    const int* hi_bc = phys_bc.hi();
+
+    RiemannFaceArgs args;
+
+    args.bx = bx;
+    args.qm = qm;
+    args.qp = qp;
+    args.flx = flx;
+#ifdef RADIATION
+    args.rflx = rflx;
+#endif
+    args.qgdnv = qgdnv;
+    args.qaux = qaux_arr;
+    args.shk = shk;
+    args.idir = idir;
+    args.geomdata = geom.data();
+
+    // do we want to force the flux to zero at the boundary?
+    args.special_bnd_lo = (lo_bc[idir] == Symmetry ||
+                           lo_bc[idir] == SlipWall ||
+                           lo_bc[idir] == NoSlipWall);
+    args.special_bnd_hi = (hi_bc[idir] == Symmetry ||
+                           hi_bc[idir] == SlipWall ||
+                           hi_bc[idir] == NoSlipWall);
+
+    args.domlo = geom.Domain().loVect3d();
+    args.domhi = geom.Domain().hiVect3d();
+
+    riemann_faces(args, riemann_solver, ppm_temp_fix == 2,
+                  hybrid_riemann == 1, store_full_state);
+
+}
+
+
@@ -3,9 +3,161 @@
 
 using namespace amrex;
 
+// Temporaries are handed out in multiples of this many Reals, so
+// each one starts on a 64-byte boundary.
+static constexpr Long mhd_scratch_align = 8;
+
+static Long
+mhd_scratch_reals (const Box& b, const int ncomp)
+{
+    const Long n = b.numPts() * ncomp;
+    return (n + mhd_scratch_align - 1) / mhd_scratch_align * mhd_scratch_align;
+}
+
+// Per-thread scratch space for the MHD update.  All of the
+// temporaries for a tile are carved out of a single buffer with a
+// stack discipline: mark() and release() let a stage hand its space
+// back once its data has been consumed, so that the next stage reuses
+// it.  On the CPU the buffer is only reallocated when a tile needs
+// more than it already holds, so each thread allocates it once.  On
+// GPUs the Elixir taken every tile keeps the buffer alive until the
+// kernels using it have finished, and the next tile gets a new one.
+
+struct MHDScratch
+{
+    FArrayBox buffer;
+    Real* base = nullptr;
+    Long capacity = 0;
+    Long top = 0;
+    Long peak = 0;
+
+    void reserve (const Long nreals)
+    {
+        // the buffer is laid out as rows of 1024 so that large tiles
+        // do not overflow the extents of a Box
+        const int nrows = static_cast<int>((nreals + 1023) / 1024);
+        buffer.resize(Box(IntVect(0, 0, 0), IntVect(1023, nrows-1, 0)), 1);
+        base = buffer.dataPtr();
+        capacity = static_cast<Long>(nrows) * 1024;
+        top = 0;
+        peak = amrex::max(peak, capacity);
+    }
+
+    Array4<Real> alloc (const Box& b, const int ncomp)
+    {
+        Real* p = base + top;
+        top += mhd_scratch_reals(b, ncomp);
+        AMREX_ALWAYS_ASSERT(top <= capacity);
+        return makeArray4(p, b, ncomp);
+    }
+
+    Long mark () const { return top; }
+
+    void release (const Long m) { top = m; }
+
+    Long peak_bytes () const { return peak * static_cast<Long>(sizeof(Real)); }
+};
+
+// The boxes for the temporaries of the tile bx.  These are shared by
+// the scratch sizing below and the update itself, so the two cannot
+// disagree.
+
+struct MHDTileBoxes
+{
+    Box bx, obx, gbx, bx_gc, bxi;
+    Box nbx, nby, nbz;
+    Box nbxf, nbyf, nbzf;
+    Box nbxe, nbye, nbze;
+    Box bfx, bfy, bfz;
+    Box ccbx, ccby, ccbz;
+
+    explicit MHDTileBoxes (const Box& tbx, const int ngrow)
+    {
+        bx = tbx;
+        obx = amrex::grow(bx, 1);
+        gbx = amrex::grow(bx, 2);
+
+        // box with NUM_GROW ghost cells for PPM stuff
+        bx_gc = amrex::grow(bx, ngrow);
+
+        // we need to compute the flattening coefficient for every zone
+        // center where we do reconstruction
+        bxi = amrex::grow(bx, IntVect(3, 3, 3));
+
+        nbx = amrex::surroundingNodes(bx, 0);
+        nby = amrex::surroundingNodes(bx, 1);
+        nbz = amrex::surroundingNodes(bx, 2);
+
+        nbxf = amrex::grow(nbx, IntVect(0, 1, 1));
+        nbyf = amrex::grow(nby, IntVect(1, 0, 1));
+        nbzf = amrex::grow(nbz, IntVect(1, 1, 0));
+
+        // need to revisit these box sizes
+        nbxe = amrex::grow(nbx, IntVect(2, 3, 3));
+        nbye = amrex::grow(nby, IntVect(3, 2, 3));
+        nbze = amrex::grow(nbz, IntVect(3, 3, 2));
+
+        // boxes for the 1D fluxes
+        // [lo(1)-2, lo(2)-3, lo(3)-3] [hi(1)+3, hi(2)+3, hi(3)+3], etc.
+        bfx = amrex::grow(nbx, IntVect(2, 3, 3));
+        bfy = amrex::grow(nby, IntVect(3, 2, 3));
+        bfz = amrex::grow(nbz, IntVect(3, 3, 2));
+
+        // boxes for the corner coupling
+        // [lo(1)-1, lo(2)-2, lo(3)-2] [hi(1)+2, hi(2)+2, hi(2)+2], etc.
+        ccbx = amrex::grow(nbx, IntVect(1, 2, 2));
+        ccby = amrex::grow(nby, IntVect(2, 1, 2));
+        ccbz = amrex::grow(nbz, IntVect(2, 2, 1));
+    }
+
+    // Number of Reals of scratch the update of this tile needs.  This
+    // follows the allocation order in construct_ctu_mhd_source: the
+    // arrays that live for the whole tile, then the conserved
+    // interface states, then the larger of the reconstruction stage
+    // and the corner coupling stage, which share the space above them.
+    Long scratch_reals () const
+    {
+        const int nflx = NUM_STATE+3;
+
+        Long whole_tile = mhd_scratch_reals(nbxf, nflx) +
+                          mhd_scratch_reals(nbyf, nflx) +
+                          mhd_scratch_reals(nbzf, nflx) +
+                          mhd_scratch_reals(nbxe, 1) +
+                          mhd_scratch_reals(nbye, 1) +
+                          mhd_scratch_reals(nbze, 1) +
+                          mhd_scratch_reals(bx_gc, NQ) +
+                          mhd_scratch_reals(bfx, nflx) +
+                          mhd_scratch_reals(bfy, nflx) +
+                          mhd_scratch_reals(bfz, nflx);
+
+        Long interface = 6 * mhd_scratch_reals(gbx, nflx);
+
+        Long reconstruct = mhd_scratch_reals(bx_gc, NQAUX) +
+                           mhd_scratch_reals(bx_gc, NQSRC) +
+                           2 * mhd_scratch_reals(bxi, 1) +
+                           2 * mhd_scratch_reals(bx_gc, NQ);
+
+        Long corner = 2 * mhd_scratch_reals(gbx, NQ) +
+                      2 * mhd_scratch_reals(ccbx, nflx) +
+                      2 * mhd_scratch_reals(ccby, nflx) +
+                      2 * mhd_scratch_reals(ccbz, nflx);
+
+        Long final_update = mhd_scratch_reals(obx, NQ) +
+                            mhd_scratch_reals(obx, 1);
+
+        return whole_tile + amrex::max(interface + amrex::max(reconstruct, corner),
+                                       final_update);
+    }
+};
+
+
 void
 Castro::construct_ctu_mhd_source(Real time, Real dt)
 {
+      BL_PROFILE("Castro::construct_ctu_mhd_source()");
+
+      const Real strt_time = ParallelDescriptor::second();
+
       if (verbose && ParallelDescriptor::IOProcessor())
         std::cout << "... mhd ...!!! " << std::endl << std::endl;
 
@@ -30,60 +182,34 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
       BL_ASSERT(NUM_GROW == 6);
 
+      // the largest per-thread scratch and the scratch summed over
+      // the threads of this rank, for the verbose output
+      Long scratch_bytes_max = 0;
+      Long scratch_bytes_sum = 0;
 
 #ifdef _OPENMP
-#pragma omp parallel
+#pragma omp parallel reduction(max:scratch_bytes_max) reduction(+:scratch_bytes_sum)
 #endif
     {
 
-      FArrayBox flux[AMREX_SPACEDIM], E[AMREX_SPACEDIM];
-
-      FArrayBox q;
-      FArrayBox qaux;
-      FArrayBox srcQ;
-
-      FArrayBox flatn;
-      FArrayBox flatg;
-
-      FArrayBox qleft[AMREX_SPACEDIM];
-      FArrayBox qright[AMREX_SPACEDIM];
-
-      FArrayBox flxx1D;
-      FArrayBox flxy1D;
-      FArrayBox flxz1D;
+      // All of the temporaries come from this thread's scratch, which
+      // is sized for the largest tile it sees.
 
-      FArrayBox ux_left;
-      FArrayBox ux_right;
-      FArrayBox uy_left;
-      FArrayBox uy_right;
-      FArrayBox uz_left;
-      FArrayBox uz_right;
+      MHDScratch scratch;
 
-      FArrayBox qtmp_left;
-      FArrayBox qtmp_right;
-
-      FArrayBox flx_xy;
-      FArrayBox flx_xz;
-
-      FArrayBox flx_yx;
-      FArrayBox flx_yz;
-
-      FArrayBox flx_zx;
-      FArrayBox flx_zy;
-
-      FArrayBox q2D;
-
-      FArrayBox div;
-
-      for (MFIter mfi(S_new); mfi.isValid(); ++mfi)
+      for (MFIter mfi(S_new, hydro_tile_size); mfi.isValid(); ++mfi)
         {
 
-          const Box& bx = mfi.tilebox();
-          const Box& obx = amrex::grow(bx, 1);
-          const Box& gbx = amrex::grow(bx, 2);
+          const MHDTileBoxes tb(mfi.tilebox(), NUM_GROW);
+
+          const Box& bx = tb.bx;
+          const Box& obx = tb.obx;
+          const Box& gbx = tb.gbx;
+          const Box& bx_gc = tb.bx_gc;
+          const Box& bxi = tb.bxi;
 
-          // box with NUM_GROW ghost cells for PPM stuff
-          const Box& bx_gc = amrex::grow(bx, NUM_GROW);
+          scratch.reserve(tb.scratch_reals());
+          auto elix_scratch = scratch.buffer.elixir();
 
           FArrayBox &statein  = Sborder[mfi];
           auto u_arr = statein.array();
@@ -113,58 +239,49 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           auto Bzo_arr = Bzout.array();
 
 
-          // allocate fabs for fluxes and electric field
+          // allocate the scratch that lives for the whole tile: the
+          // fluxes and electric field, the primitive state, and the
+          // 1D fluxes
 
-          const Box& nbx = amrex::surroundingNodes(bx, 0);
-          const Box& nby = amrex::surroundingNodes(bx, 1);
-          const Box& nbz = amrex::surroundingNodes(bx, 2);
+          auto flxx_arr = scratch.alloc(tb.nbxf, NUM_STATE+3);
+          auto flxy_arr = scratch.alloc(tb.nbyf, NUM_STATE+3);
+          auto flxz_arr = scratch.alloc(tb.nbzf, NUM_STATE+3);
 
-          const Box& nbxf = amrex::grow(nbx, IntVect(0, 1, 1));
-          const Box& nbyf = amrex::grow(nby, IntVect(1, 0, 1));
-          const Box& nbzf = amrex::grow(nbz, IntVect(1, 1, 0));
+          Array4<Real> const flux_arr[AMREX_SPACEDIM] = {flxx_arr, flxy_arr, flxz_arr};
 
-          // need to revisit these box sizes
-          const Box& nbxe = amrex::grow(nbx, IntVect(2, 3, 3));
-          const Box& nbye = amrex::grow(nby, IntVect(3, 2, 3));
-          const Box& nbze = amrex::grow(nbz, IntVect(3, 3, 2));
+          auto Ex_arr = scratch.alloc(tb.nbxe, 1);
+          auto Ey_arr = scratch.alloc(tb.nbye, 1);
+          auto Ez_arr = scratch.alloc(tb.nbze, 1);
 
-          flux[0].resize(nbxf, NUM_STATE+3);
-          auto flxx_arr = flux[0].array();
-          auto elix_flxx = flux[0].elixir();
+          auto q_arr = scratch.alloc(bx_gc, NQ);
 
-          E[0].resize(nbxe);
-          auto Ex_arr = E[0].array();
-          auto elix_Ex = E[0].elixir();
+          auto flxx1D_arr = scratch.alloc(tb.bfx, NUM_STATE+3);
+          auto flxy1D_arr = scratch.alloc(tb.bfy, NUM_STATE+3);
+          auto flxz1D_arr = scratch.alloc(tb.bfz, NUM_STATE+3);
 
-          flux[1].resize(nbyf, NUM_STATE+3);
-          auto flxy_arr = flux[1].array();
-          auto elix_flxy = flux[1].elixir();
+          Array4<Real> const flx1D_arr[AMREX_SPACEDIM] = {flxx1D_arr, flxy1D_arr, flxz1D_arr};
 
-          E[1].resize(nbye);
-          auto Ey_arr = E[1].array();
-          auto elix_Ey = E[1].elixir();
+          const Long whole_tile_mark = scratch.mark();
 
-          flux[2].resize(nbzf, NUM_STATE+3);
-          auto flxz_arr = flux[2].array();
-          auto elix_flxz = flux[2].elixir();
+          // the conserved interface states are built during the
+          // reconstruction and used through the corner coupling
 
-          E[2].resize(nbze);
-          auto Ez_arr = E[2].array();
-          auto elix_Ez = E[2].elixir();
+          auto ux_left_arr = scratch.alloc(gbx, NUM_STATE+3);
+          auto ux_right_arr = scratch.alloc(gbx, NUM_STATE+3);
+          auto uy_left_arr = scratch.alloc(gbx, NUM_STATE+3);
+          auto uy_right_arr = scratch.alloc(gbx, NUM_STATE+3);
+          auto uz_left_arr = scratch.alloc(gbx, NUM_STATE+3);
+          auto uz_right_arr = scratch.alloc(gbx, NUM_STATE+3);
 
+          Array4<Real> const u_left_arr[AMREX_SPACEDIM] = {ux_left_arr, uy_left_arr, uz_left_arr};
+          Array4<Real> const u_right_arr[AMREX_SPACEDIM] = {ux_right_arr, uy_right_arr, uz_right_arr};
 
-          // Calculate primitives based on conservatives
-          q.resize(bx_gc, NQ);
-          auto q_arr = q.array();
-          auto elix_q = q.elixir();
+          const Long interface_mark = scratch.mark();
 
-          qaux.resize(bx_gc, NQAUX);
-          auto qaux_arr = qaux.array();
-          auto elix_qaux = qaux.elixir();
 
-          srcQ.resize(bx_gc, NQSRC);
-          auto src_q_arr = srcQ.array();
-          auto elix_src_q = srcQ.elixir();
+          // Calculate primitives based on conservatives
+          auto qaux_arr = scratch.alloc(bx_gc, NQAUX);
+          auto src_q_arr = scratch.alloc(bx_gc, NQSRC);
 
           Array4<Real> const old_src_arr = old_source.array(mfi);
           Array4<Real> const src_corr_arr = source_corrector.array(mfi);
@@ -181,15 +298,8 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           // we need to compute the flattening coefficient for every zone
           // center where we do reconstruction
 
-          const Box& bxi = amrex::grow(bx, IntVect(3, 3, 3));
-
-          flatn.resize(bxi, 1);
-          auto flatn_arr = flatn.array();
-          auto elix_flatn = flatn.elixir();
-
-          flatg.resize(bxi, 1);
-          auto flatg_arr = flatg.array();
-          auto elix_flatg = flatg.elixir();
+          auto flatn_arr = scratch.alloc(bxi, 1);
+          auto flatg_arr = scratch.alloc(bxi, 1);
 
           if (use_flattening == 0) {
             amrex::ParallelFor(bxi,
@@ -211,31 +321,18 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           }
 
-          // Interpolate Cell centered values to faces
-          qleft[0].resize(bx_gc, NQ);
-          auto qx_left_arr = qleft[0].array();
-          auto elix_qx_left = qleft[0].elixir();
-
-          qright[0].resize(bx_gc, NQ);
-          auto qx_right_arr = qright[0].array();
-          auto elix_qx_right = qright[0].elixir();
-
-          qleft[1].resize(bx_gc, NQ);
-          auto qy_left_arr = qleft[1].array();
-          auto elix_qy_left = qleft[1].elixir();
+          // Interpolate Cell centered values to faces, one direction
+          // at a time.  The interface states are consumed by the 1D
+          // fluxes and the conversion to conserved variables right
+          // away, so all three directions share one pair of arrays.
 
-          qright[1].resize(bx_gc, NQ);
-          auto qy_right_arr = qright[1].array();
-          auto elix_qy_right = qright[1].elixir();
+          auto qleft_arr = scratch.alloc(bx_gc, NQ);
+          auto qright_arr = scratch.alloc(bx_gc, NQ);
 
-          qleft[2].resize(bx_gc, NQ);
-          auto qz_left_arr = qleft[2].array();
-          auto elix_qz_left = qleft[2].elixir();
-
-          qright[2].resize(bx_gc, NQ);
-          auto qz_right_arr = qright[2].array();
-          auto elix_qz_right = qright[2].elixir();
+          // MM CTU Step 1
+          // Calculate Flux 1D, eq.35, and the conserved interface states
 
+          const Box bf[AMREX_SPACEDIM] = {tb.bfx, tb.bfy, tb.bfz};
 
           for (int idir = 0; idir < AMREX_SPACEDIM; idir++) {
 
@@ -243,90 +340,33 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
               plm(bxi, idir,
                   q_arr, qaux_arr, flatn_arr,
                   Bx_arr, By_arr, Bz_arr,
-                  qleft[idir].array(), qright[idir].array(),
+                  qleft_arr, qright_arr,
                   src_q_arr, dt);
 
             } else {
               ppm_mhd(bxi, idir,
                       q_arr, qaux_arr, flatn_arr,
                       Bx_arr, By_arr, Bz_arr,
-                      qleft[idir].array(), qright[idir].array(),
+                      qleft_arr, qright_arr,
                       src_q_arr, dt);
             }
-          }
-
-          // Corner Couple and find the correct fluxes + electric fields
-
-          // Do the corner coupling and the CT updates
-
-          // MM CTU Step 1
-          // Calculate Flux 1D, eq.35
-
-          // x-dir
-          // [lo(1)-2, lo(2)-3, lo(3)-3] [hi(1)+3, hi(2)+3, hi(3)+3]
-          const Box& bfx = amrex::grow(nbx, IntVect(2, 3, 3));
-
-          flxx1D.resize(bfx, NUM_STATE+3);
-          auto flxx1D_arr = flxx1D.array();
-          auto elix_flxx1D = flxx1D.elixir();
-
-          hlld(bfx, qleft[0].array(), qright[0].array(), flxx1D_arr, 0);
-
-          // y-dir
-          // [lo(1)-3, lo(2)-2, lo(3)-3] [hi(1)+3, hi(2)+3, hi(3)+3]
-          const Box& bfy = amrex::grow(nby, IntVect(3, 2, 3));
-
-          flxy1D.resize(bfy, NUM_STATE+3);
-          auto flxy1D_arr = flxy1D.array();
-          auto elix_flxy1D = flxy1D.elixir();
-
-          hlld(bfy, qleft[1].array(), qright[1].array(), flxy1D_arr, 1);
-
-          // z-dir
-          // [lo(1)-3, lo(2)-3, lo(3)-2] [hi(1)+3, hi(2)+3, hi(3)+3]
-          const Box& bfz = amrex::grow(nbz, IntVect(3, 3, 2));
-
-          flxz1D.resize(bfz, NUM_STATE+3);
-          auto flxz1D_arr = flxz1D.array();
-          auto elix_flxz1D = flxz1D.elixir();
 
-          hlld(bfz, qleft[2].array(), qright[2].array(), flxz1D_arr, 2);
+            hlld(bf[idir], qleft_arr, qright_arr, flx1D_arr[idir], idir);
 
+            // Prim to Cons
 
-          // Prim to Cons
-
-          ux_left.resize(gbx, NUM_STATE+3);
-          auto ux_left_arr = ux_left.array();
-          auto elix_ux_left = ux_left.elixir();
-
-          ux_right.resize(gbx, NUM_STATE+3);
-          auto ux_right_arr = ux_right.array();
-          auto elix_ux_right = ux_right.elixir();
-
-          PrimToCons(gbx, qx_left_arr, ux_left_arr);
-          PrimToCons(gbx, qx_right_arr, ux_right_arr);
-
-          uy_left.resize(gbx, NUM_STATE+3);
-          auto uy_left_arr = uy_left.array();
-          auto elix_uy_left = uy_left.elixir();
-
-          uy_right.resize(gbx, NUM_STATE+3);
-          auto uy_right_arr = uy_right.array();
-          auto elix_uy_right = uy_right.elixir();
+            PrimToCons(gbx, qleft_arr, u_left_arr[idir]);
+            PrimToCons(gbx, qright_arr, u_right_arr[idir]);
+          }
 
-          PrimToCons(gbx, qy_left_arr, uy_left_arr);
-          PrimToCons(gbx, qy_right_arr, uy_right_arr);
+          // the reconstruction is done -- the corner coupling reuses
+          // its space
 
-          uz_left.resize(gbx, NUM_STATE+3);
-          auto uz_left_arr = uz_left.array();
-          auto elix_uz_left = uz_left.elixir();
+          scratch.release(interface_mark);
 
-          uz_right.resize(gbx, NUM_STATE+3);
-          auto uz_right_arr = uz_right.array();
-          auto elix_uz_right = uz_right.elixir();
+          // Corner Couple and find the correct fluxes + electric fields
 
-          PrimToCons(gbx, qz_left_arr, uz_left_arr);
-          PrimToCons(gbx, qz_right_arr, uz_right_arr);
+          // Do the corner coupling and the CT updates
 
           // MM CTU Step 2
           // Use "1D" fluxes To interpolate Temporary Edge Centered Electric Fields, eq.36
@@ -362,15 +402,10 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // affected by Y Flux
           // [lo(1)-1, lo(2)-2, lo(3)-2] [hi(1)+2, hi(2)+2, hi(2)+2]
-          const Box& ccbx = amrex::grow(nbx, IntVect(1, 2, 2));
+          const Box& ccbx = tb.ccbx;
 
-          qtmp_left.resize(gbx, NQ);
-          auto qtmp_left_arr = qtmp_left.array();
-          auto elix_qtmp_left = qtmp_left.elixir();
-
-          qtmp_right.resize(gbx, NQ);
-          auto qtmp_right_arr = qtmp_right.array();
-          auto elix_qtmp_right = qtmp_right.elixir();
+          auto qtmp_left_arr = scratch.alloc(gbx, NQ);
+          auto qtmp_right_arr = scratch.alloc(gbx, NQ);
 
           corner_couple(ccbx,
                         qtmp_right_arr, qtmp_left_arr,
@@ -380,9 +415,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // Calculate Flux 2D eq. 40
           // F^{x|y}
-          flx_xy.resize(ccbx, NUM_STATE+3);
-          auto flx_xy_arr = flx_xy.array();
-          auto elix_flx_xy = flx_xy.elixir();
+          auto flx_xy_arr = scratch.alloc(ccbx, NUM_STATE+3);
 
           hlld(ccbx, qtmp_left_arr, qtmp_right_arr, flx_xy_arr, 0);
 
@@ -394,9 +427,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                         0, 2, 1, dt);
 
           // F^{x|z}
-          flx_xz.resize(ccbx, NUM_STATE+3);
-          auto flx_xz_arr = flx_xz.array();
-          auto elix_flx_xz = flx_xz.elixir();
+          auto flx_xz_arr = scratch.alloc(ccbx, NUM_STATE+3);
 
           hlld(ccbx, qtmp_left_arr, qtmp_right_arr, flx_xz_arr, 0);
 
@@ -405,7 +436,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // affected by X Flux
           // [lo(1)-2, lo(2)-1, lo(3)-2] [hi(1)+2, hi(2)+2, hi(3)+2]
-          const Box& ccby = amrex::grow(nby, IntVect(2, 1, 2));
+          const Box& ccby = tb.ccby;
 
           corner_couple(ccby,
                         qtmp_right_arr, qtmp_left_arr,
@@ -414,9 +445,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                         1, 0, 2, dt);
 
           // F^{y|x}
-          flx_yx.resize(ccby, NUM_STATE+3);
-          auto flx_yx_arr = flx_yx.array();
-          auto elix_flx_yx = flx_yx.elixir();
+          auto flx_yx_arr = scratch.alloc(ccby, NUM_STATE+3);
 
           hlld(ccby, qtmp_left_arr, qtmp_right_arr, flx_yx_arr, 1);
 
@@ -429,9 +458,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                         1, 2, 0, dt);
 
           // F^{y|z}
-          flx_yz.resize(ccby, NUM_STATE+3);
-          auto flx_yz_arr = flx_yz.array();
-          auto elix_flx_yz = flx_yz.elixir();
+          auto flx_yz_arr = scratch.alloc(ccby, NUM_STATE+3);
 
           hlld(ccby, qtmp_left_arr, qtmp_right_arr, flx_yz_arr, 1);
 
@@ -439,7 +466,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // affected by X Flux
           // [lo(1)-2, lo(2)-2, lo(3)-1] [hi(1)+2, hi(2)+2, hi(3)+2]
-          const Box& ccbz = amrex::grow(nbz, IntVect(2, 2, 1));
+          const Box& ccbz = tb.ccbz;
 
           corner_couple(ccbz,
                         qtmp_right_arr, qtmp_left_arr,
@@ -448,9 +475,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                         2, 0, 1, dt);
 
           // F^{z|x}
-          flx_zx.resize(ccbz, NUM_STATE+3);
-          auto flx_zx_arr = flx_zx.array();
-          auto elix_flx_zx = flx_zx.elixir();
+          auto flx_zx_arr = scratch.alloc(ccbz, NUM_STATE+3);
 
           hlld(ccbz, qtmp_left_arr, qtmp_right_arr, flx_zx_arr, 2);
 
@@ -463,9 +488,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                         2, 1, 0, dt);
 
           // F^{z|y}
-          flx_zy.resize(ccbz, NUM_STATE+3);
-          auto flx_zy_arr = flx_zy.array();
-          auto elix_flx_zy = flx_zy.elixir();
+          auto flx_zy_arr = scratch.alloc(ccbz, NUM_STATE+3);
 
           hlld(ccbz, qtmp_left_arr, qtmp_right_arr, flx_zy_arr, 2);
 
@@ -524,7 +547,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // for x direction
           // [lo(1), lo(2)-1, lo(3)-1][hi(1)+1, hi(2)+1, hi(3)+1]
-          const Box& nbx1 = amrex::grow(nbx, IntVect(0, 1, 1));
+          const Box& nbx1 = amrex::grow(tb.nbx, IntVect(0, 1, 1));
 
           half_step(nbx1,
                     qtmp_right_arr, qtmp_left_arr,
@@ -538,10 +561,10 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           // We need to compute these on a box 1 larger in the transverse directions
           // than we'd need for hydro alone due to the electric update
 
-          hlld(nbx1, qtmp_left_arr, qtmp_right_arr, flux[0].array(), 0);
+          hlld(nbx1, qtmp_left_arr, qtmp_right_arr, flxx_arr, 0);
 
           // for y direction
-          const Box& nby1 = amrex::grow(nby, IntVect(1, 0, 1));
+          const Box& nby1 = amrex::grow(tb.nby, IntVect(1, 0, 1));
 
           half_step(nby1,
                     qtmp_right_arr, qtmp_left_arr,
@@ -550,10 +573,10 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                     Ey_arr, Ex_arr, Ez_arr,
                     1, 0, 2, dt);
 
-          hlld(nby1, qtmp_left_arr, qtmp_right_arr, flux[1].array(), 1);
+          hlld(nby1, qtmp_left_arr, qtmp_right_arr, flxy_arr, 1);
 
           // for z direction
-          const Box& nbz1 = amrex::grow(nbz, IntVect(1, 1, 0));
+          const Box& nbz1 = amrex::grow(tb.nbz, IntVect(1, 1, 0));
 
           half_step(nbz1,
                     qtmp_right_arr, qtmp_left_arr,
@@ -562,14 +585,16 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
                     Ez_arr, Ex_arr, Ey_arr,
                     2, 0, 1, dt);
 
-          hlld(nbz1, qtmp_left_arr, qtmp_right_arr, flux[2].array(), 2);
+          hlld(nbz1, qtmp_left_arr, qtmp_right_arr, flxz_arr, 2);
+
+          // the interface states and the 2D fluxes have been consumed
+
+          scratch.release(whole_tile_mark);
 
 
           // MM CTU Step 10
           // Primitive update eq. 48
-          q2D.resize(obx, NQ);
-          auto q2D_arr = q2D.array();
-          auto elix_q2D = q2D.elixir();
+          auto q2D_arr = scratch.alloc(obx, NQ);
 
           prim_half(obx, q2D_arr, q_arr,
                     flxx1D_arr, flxy1D_arr, flxz1D_arr, dt);
@@ -599,9 +624,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           // clean the final fluxes
 
-          div.resize(obx, 1);
-          Elixir elix_div = div.elixir();
-          auto div_arr = div.array();
+          auto div_arr = scratch.alloc(obx, 1);
 
           // compute divu -- we'll use this later when doing the artifical viscosity
           divu(obx, q_arr, div_arr);
@@ -610,21 +633,21 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
             const Box& nbx = amrex::surroundingNodes(bx, idir);
 
-            Array4<Real> const flux_arr = (flux[idir]).array();
+            Array4<Real> const flux_idir = flux_arr[idir];
 
             // Zero out shock and temp fluxes -- these are physically meaningless here
             amrex::ParallelFor(nbx,
             [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
             {
-              flux_arr(i,j,k,UTEMP) = 0.e0;
+              flux_idir(i,j,k,UTEMP) = 0.e0;
 #ifdef SHOCK_VAR
-              flux_arr(i,j,k,USHK) = 0.e0;
+              flux_idir(i,j,k,USHK) = 0.e0;
 #endif
             });
 
-            apply_av(nbx, idir, div_arr, u_arr, flux_arr);
+            apply_av(nbx, idir, div_arr, u_arr, flux_idir);
 
-            normalize_species_fluxes(nbx, flux_arr);
+            normalize_species_fluxes(nbx, flux_idir);
 
           }
 
@@ -633,11 +656,13 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           consup_mhd(bx, dt, update_arr, flxx_arr, flxy_arr, flxz_arr);
 
-          // magnetic update
+          // magnetic update -- neighboring tiles share the faces on
+          // their common boundary, so each tile only updates the faces
+          // it owns
 
           Real dtdx = dt / dx[0];
 
-          amrex::ParallelFor(nbx,
+          amrex::ParallelFor(mfi.nodaltilebox(0),
           [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
           {
             Bxo_arr(i,j,k) = Bx_arr(i,j,k) + dtdx *
@@ -650,7 +675,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           dtdx = 0.0_rt;
 #endif
 
-          amrex::ParallelFor(nby,
+          amrex::ParallelFor(mfi.nodaltilebox(1),
           [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
           {
             Byo_arr(i,j,k) = By_arr(i,j,k) + dtdx *
@@ -663,7 +688,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           dtdx = 0.0_rt;
 #endif
 
-          amrex::ParallelFor(nbz,
+          amrex::ParallelFor(mfi.nodaltilebox(2),
           [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
           {
             Bzo_arr(i,j,k) = Bz_arr(i,j,k) + dtdx *
@@ -686,7 +711,7 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           for (int idir = 0; idir < AMREX_SPACEDIM; idir++) {
 
-            Array4<Real> const flux_fab = (flux[idir]).array();
+            Array4<Real> const flux_fab = flux_arr[idir];
             Array4<Real> fluxes_fab = (*fluxes[idir]).array(mfi);
             const int numcomp = NUM_STATE;
 
@@ -718,7 +743,36 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
         }
 
+      scratch_bytes_max = amrex::max(scratch_bytes_max, scratch.peak_bytes());
+      scratch_bytes_sum += scratch.peak_bytes();
+
     }
 
-}
+    if (verbose && ParallelDescriptor::IOProcessor())
+      std::cout << "... Leaving construct_ctu_mhd_source()" << std::endl << std::endl;
+
+    if (verbose > 0)
+      {
+        const int IOProc   = ParallelDescriptor::IOProcessorNumber();
+        Real      run_time = ParallelDescriptor::second() - strt_time;
+        const Real nzones  = static_cast<Real>(grids.numPts());
+
+#ifdef BL_LAZY
+        Lazy::QueueReduction( [=] () mutable {
+#endif
+          ParallelDescriptor::ReduceRealMax(run_time,IOProc);
+          ParallelDescriptor::ReduceLongMax(scratch_bytes_max,IOProc);
+          ParallelDescriptor::ReduceLongMax(scratch_bytes_sum,IOProc);
+
+          if (ParallelDescriptor::IOProcessor()) {
+            std::cout << "Castro::construct_ctu_mhd_source() time = " << run_time
+                      << ", zones/s = " << nzones / run_time << "\n";
+            std::cout << "    peak scratch bytes per thread = " << scratch_bytes_max
+                      << ", per rank = " << scratch_bytes_sum << "\n" << "\n";
+          }
+#ifdef BL_LAZY
+          });
+#endif
+      }
 
+}
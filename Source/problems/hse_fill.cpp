@@ -1,8 +1,16 @@
 #include <AMReX_BLFort.H>
+#include <AMReX_GpuContainers.H>
 #include <Castro.H>
+#include <Castro_bc_fill_nd.H>
 #include <runtime_parameters.H>
 #include <ext_bc_types.H>
 
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace amrex;
 
 
@@ -10,787 +18,578 @@ using namespace amrex;
 // that the gravitation acceleration is constant
 
 
-void
-hse_fill(const Box& bx, Array4<Real> const& adv,
-              Geometry const& geom, const Vector<BCRec>& bcr,
-              const Real time)
-{
-
+// The HSE ghost zones of a column depend only on the state in the
+// zone just inside the boundary (and the temperature of the zone
+// behind it, when hse_interp_temp = 1), the zone width, and which face
+// we are on.  We cache the integrated profile -- the density,
+// temperature, and specific internal energy of each ghost zone --
+// keyed on those, and reuse it when a later fill sees the same edge
+// state (to within castro.hse_fill_cache_tol).  The table is
+// direct-mapped: an entry is replaced by the next column that misses
+// in its slot.
 
-    auto domlo = geom.Domain().loVect3d();
-    auto domhi = geom.Domain().hiVect3d();
-
-    auto problo = geom.ProbLoArray();
-
-    auto lo = bx.loVect();
-    auto hi = bx.hiVect();
-
-    auto adv_bx = Box(adv);
-    auto adv_lo = adv_bx.loVect3d();
-    auto adv_hi = adv_bx.hiVect3d();
-
-    auto dx = geom.CellSizeArray();
-
-    //
-    // x boundaries
-    //
+constexpr int hse_cache_slots = 4096;
+constexpr int hse_cache_max_ghost = 8;
 
-    // XLO
+// dens, temp, and the extrapolation temperature of the edge zone, the
+// zone width, the face, then the mass fractions and aux data
+constexpr int hse_cache_nkey = 5 + NumSpec + NumAux;
 
-    if (bcr[URHO].lo(0) == EXT_DIR && lo[0] < domlo[0]) {
+struct HSECacheEntry
+{
+    Real key[hse_cache_nkey];
+    Real dens[hse_cache_max_ghost];
+    Real temp[hse_cache_max_ghost];
+    Real eint[hse_cache_max_ghost];
+    int nghost;
+};
+
+struct HSECache
+{
+    Gpu::DeviceVector<HSECacheEntry> entries;
 
-        if (xl_ext_bc_type == EXT_HSE) {
+    // the column that gets to insert its profile into each slot
+    Gpu::DeviceVector<int> winner;
+};
 
-            // we need to integrate in the i direction from adv_lo[0]
-            // to domlo[0]-1, but we want that to be handled by a
-            // single thread on the GPU
+static Vector<HSECache> hse_caches;
 
-            Box gbx(IntVect(D_DECL(domlo[0]-1, lo[1], lo[2])),
-                    IntVect(D_DECL(domlo[0]-1, hi[1], hi[2])));
+static Long hse_cache_hits = 0;
+static Long hse_cache_columns = 0;
 
-            amrex::ParallelFor(gbx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
 
-                Real dens_above = adv(domlo[0],j,k,URHO);
-                Real temp_above = adv(domlo[0],j,k,UTEMP);
-                Real X_zone[NumSpec];
-                for (int n = 0; n < NumSpec; n++) {
-                    X_zone[n] = adv(domlo[0],j,k,UFS+n) / dens_above;
-                }
-#if NAUX_NET > 0
-                Real aux_zone[NumAux];
-                for (int n = 0; n < NumAux; n++) {
-                    aux_zone[n] = adv(domlo[0],j,k,UFX+n) / dens_above;
-                }
+static HSECache&
+hse_cache_for_thread ()
+{
+    // the boundary fills of different boxes can run concurrently, so
+    // each OpenMP thread gets its own table
+
+    static bool initialized = [] () {
+#ifdef _OPENMP
+        hse_caches.resize(omp_get_max_threads());
+#else
+        hse_caches.resize(1);
 #endif
-
-                //  keep track of the density at the base of the domain
-
-                Real dens_base = dens_above;
-
-                // get pressure in this zone (the initial above zone)
-
-                eos_rep_t eos_state;
-                eos_state.rho = dens_above;
-                eos_state.T = temp_above;
-                for (int n = 0; n < NumSpec; n++) {
-                    eos_state.xn[n] = X_zone[n];
-                }
-#if NAUX_NET > 0
-                for (int n = 0; n < NumAux; n++) {
-                    eos_state.aux[n] = aux_zone[n];
-                }
+        amrex::ExecOnFinalize([] () { hse_caches.clear(); });
+        return true;
+    }();
+    amrex::ignore_unused(initialized);
+
+#ifdef _OPENMP
+    HSECache& cache = hse_caches[omp_get_thread_num()];
+#else
+    HSECache& cache = hse_caches[0];
 #endif
 
-                eos(eos_input_rt, eos_state);
+    if (cache.entries.empty()) {
+        cache.entries.resize(hse_cache_slots);
+        cache.winner.resize(hse_cache_slots);
 
-                Real pres_above = eos_state.p;
+        HSECacheEntry* entries = cache.entries.data();
+        int* winner = cache.winner.data();
 
-                for (int ii = domlo[0]-1; ii >= adv_lo[0]; ii--) {
+        amrex::ParallelFor(hse_cache_slots,
+        [=] AMREX_GPU_HOST_DEVICE (int n)
+        {
+            entries[n].nghost = 0;
+            winner[n] = -1;
+        });
+    }
 
-                    // we are integrating along a column at constant i.
-                    // Make sure that our starting state is well-defined
+    return cache;
+}
 
-                    // HSE integration to get density, pressure
 
-                    // initial guesses
+// Mask off the low mantissa bits that are below the tolerance, so that
+// edge states that agree to within it usually hash to the same slot.
 
-                    Real dens_zone = dens_above;
+static unsigned long long
+hse_cache_mask (const Real tol)
+{
+    if (tol <= 0.0_rt) {
+        return ~0ULL;
+    }
 
-                    // temperature and species held constant in BCs
+    int nbits = static_cast<int>(std::ceil(-std::log2(tol)));
+    nbits = amrex::max(0, amrex::min(52, nbits));
 
-                    Real temp_zone;
-                    if (hse_interp_temp == 1) {
-                        temp_zone = 2*adv(ii+1,j,k,UTEMP) - adv(ii+2,j,k,UTEMP);
-                    } else {
-                        temp_zone = temp_above;
-                    }
+    return ~((1ULL << (52 - nbits)) - 1ULL);
+}
 
-                    bool converged_hse = false;
 
-                    Real p_want;
-                    Real drho;
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+static int
+hse_cache_slot (const Real* key, const unsigned long long mask)
+{
+    unsigned long long h = 14695981039346656037ULL;
 
-                    for (int iter = 0; iter < hse::MAX_ITER; iter++) {
+    for (int n = 0; n < hse_cache_nkey; n++) {
+        double v = key[n];
+        unsigned long long bits;
+        std::memcpy(&bits, &v, sizeof(double));
+        h = (h ^ (bits & mask)) * 1099511628211ULL;
+    }
 
-                        // pressure needed from HSE
+    return static_cast<int>(h & static_cast<unsigned long long>(hse_cache_slots - 1));
+}
 
-                        p_want = pres_above -
-                            dx[0] * 0.5_rt * (dens_zone + dens_above) * gravity::const_grav;
 
-                        // pressure from EOS
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+static bool
+hse_cache_match (const HSECacheEntry& entry, const Real* key,
+                 const int ng, const Real tol)
+{
+    if (entry.nghost < ng) {
+        return false;
+    }
 
-                        eos_state.rho = dens_zone;
-                        eos_state.T = temp_zone;
-                        // xn is already set above
+    for (int n = 0; n < hse_cache_nkey; n++) {
+        if (std::abs(entry.key[n] - key[n]) > tol * std::abs(key[n])) {
+            return false;
+        }
+    }
 
-                        eos(eos_input_rt, eos_state);
+    return true;
+}
 
-                        Real pres_zone = eos_state.p;
-                        Real dpdr = eos_state.dpdr;
 
-                        // Newton-Raphson - we want to zero A = p_want - p(rho)
-                        Real A = p_want - pres_zone;
-                        drho = A / (dpdr + 0.5_rt * dx[0] * gravity::const_grav);
+// Build the cache key from the zone ie just inside the boundary.
 
-                        dens_zone = amrex::max(0.9_rt*dens_zone,
-                                               amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+static void
+hse_cache_key (Array4<Real const> const& adv, const IntVect& ie,
+               const int idir, const int side, const Real dxn,
+               Real* key)
+{
+    const Real dens_edge = adv(ie,URHO);
 
-                        // convergence?
+    key[0] = dens_edge;
+    key[1] = adv(ie,UTEMP);
 
-                        if (std::abs(drho) < hse::TOL * dens_zone) {
-                            converged_hse = true;
-                            break;
-                        }
+    if (hse_interp_temp == 1) {
+        IntVect iin = ie;
+        iin[idir] -= side;
+        key[2] = adv(iin,UTEMP);
+    } else {
+        key[2] = 0.0_rt;
+    }
 
-                    }
+    key[3] = dxn;
+    key[4] = static_cast<Real>(2*idir + (side > 0 ? 1 : 0));
 
-#ifndef AMREX_USE_GPU
-                    if (! converged_hse) {
-                        std::cout << "ii, j, k, domlo[0]: " << ii << " " << j << " " << k << " " << domlo[0] << std::endl;
-                        std::cout << "p_want:    " << p_want << std::endl;
-                        std::cout << "dens_zone: " << dens_zone << std::endl;
-                        std::cout << "temp_zone: " << temp_zone << std::endl;
-                        std::cout << "drho:      " << drho << std::endl;
-                        std::cout << std::endl;
-                        std::cout << "column info: " << std::endl;
-                        std::cout << "   dens: " << adv(ii,j,k,URHO) << std::endl;
-                        std::cout << "   temp: " << adv(ii,j,k,UTEMP) << std::endl;
-                        amrex::Error("ERROR in bc_ext_fill_nd: failure to converge in -X BC");
-                   }
+    for (int n = 0; n < NumSpec; n++) {
+        key[5+n] = adv(ie,UFS+n) / dens_edge;
+    }
+#if NAUX_NET > 0
+    for (int n = 0; n < NumAux; n++) {
+        key[5+NumSpec+n] = adv(ie,UFX+n) / dens_edge;
+    }
 #endif
+}
 
-                   // velocity
-
-                   if (hse_zero_vels == 1) {
-
-                       // zero normal momentum causes pi waves to pass through
 
-                       adv(ii,j,k,UMX) = 0.0_rt;
-                       adv(ii,j,k,UMY) = 0.0_rt;
-                       adv(ii,j,k,UMZ) = 0.0_rt;
+// Fill the HSE ghost zones on one face of the domain.  idir is the
+// direction normal to the face and side is -1 for the lower face and
+// +1 for the upper face.  Each column of the face is integrated
+// outward from the boundary by a single thread.
 
-                   } else {
+static void
+hse_fill_face (const Box& bx, Array4<Real> const& adv,
+               Geometry const& geom, const int idir, const int side)
+{
 
-                      if (hse_reflect_vels == 1) {
-                          // reflect normal, zero gradient for transverse
-                          // note: we need to match the corresponding
-                          // zone on the other side of the interface
-                          int ioff = domlo[0]-ii-1;
-                          adv(ii,j,k,UMX) = -dens_zone * (adv(domlo[0]+ioff,j,k,UMX) / adv(domlo[0]+ioff,j,k,URHO));
+    const Box& domain = geom.Domain();
+    const Box adv_bx = Box(adv);
 
-                          adv(ii,j,k,UMY) = -dens_zone * (adv(domlo[0],j,k,UMY) / dens_base);
-                          adv(ii,j,k,UMZ) = -dens_zone * (adv(domlo[0],j,k,UMZ) / dens_base);
-                      } else {
-                          // zero gradient
-                          adv(ii,j,k,UMX) = dens_zone * (adv(domlo[0],j,k,UMX) / dens_base);
-                          adv(ii,j,k,UMY) = dens_zone * (adv(domlo[0],j,k,UMY) / dens_base);
-                          adv(ii,j,k,UMZ) = dens_zone * (adv(domlo[0],j,k,UMZ) / dens_base);
-                      }
-                   }
+    // the zone just inside the domain, and the number of ghost zones
+    // we integrate through
 
-                   eos_state.rho = dens_zone;
-                   eos_state.T = temp_zone;
+    const int edge = side < 0 ? domain.smallEnd(idir) : domain.bigEnd(idir);
+    const int ng = side < 0 ? edge - adv_bx.smallEnd(idir) : adv_bx.bigEnd(idir) - edge;
 
-                   eos(eos_input_rt, eos_state);
+    const Real dxn = geom.CellSize(idir);
 
-                   Real pres_zone = eos_state.p;
-                   Real eint = eos_state.e;
+    // the first ghost zone of each column
 
-                   // store the final state
+    Box gbx(bx);
+    gbx.setRange(idir, edge + side);
 
-                   adv(ii,j,k,URHO) = dens_zone;
-                   adv(ii,j,k,UEINT) = dens_zone * eint;
-                   adv(ii,j,k,UEDEN) = dens_zone * eint +
-                       0.5_rt * (adv(ii,j,k,UMX) * adv(ii,j,k,UMX) +
-                                 adv(ii,j,k,UMY) * adv(ii,j,k,UMY) +
-                                 adv(ii,j,k,UMZ) * adv(ii,j,k,UMZ)) / dens_zone;
-                   adv(ii,j,k,UTEMP) = temp_zone;
-                   for (int n = 0; n < NumSpec; n++) {
-                       adv(ii,j,k,UFS+n) = dens_zone * X_zone[n];
-                   }
-#if NAUX_NET > 0
-                   for (int n = 0; n < NumAux; n++) {
-                       adv(ii,j,k,UFX+n) = dens_zone * aux_zone[n];
-                   }
-#endif
+    const bool use_cache = hse_fill_cache == 1 && ng <= hse_cache_max_ghost;
 
-                   // for the next zone
+    HSECacheEntry* entries = nullptr;
+    int* winner = nullptr;
+    const Real tol = hse_fill_cache_tol;
+    const unsigned long long mask = hse_cache_mask(tol);
 
-                   dens_above = dens_zone;
-                   pres_above = pres_zone;
+    // the profiles integrated by the columns that missed, which are
+    // inserted into the table once every column is done
 
-                }
-            });
+    FArrayBox prof;
+    Array4<Real> prof_arr;
 
-        }
+    if (use_cache) {
+        HSECache& cache = hse_cache_for_thread();
+        entries = cache.entries.data();
+        winner = cache.winner.data();
 
+        prof.resize(gbx, 3*ng);
+        prof_arr = prof.array();
     }
+    Elixir elix_prof = prof.elixir();
 
+    ReduceOps<ReduceOpSum> reduce_op;
+    ReduceData<int> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
 
-    // XHI
-
-    if (bcr[URHO].hi(0) == EXT_DIR && hi[0] > domhi[0]) {
+    reduce_op.eval(gbx, reduce_data,
+    [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
+    {
+        const IntVect iv(AMREX_D_DECL(i, j, k));
 
-       if (xr_ext_bc_type == EXT_HSE) {
+        IntVect ie = iv;
+        ie[idir] = edge;
 
-            Box gbx(IntVect(D_DECL(domhi[0]+1, lo[1], lo[2])),
-                    IntVect(D_DECL(domhi[0]+1, hi[1], hi[2])));
+        Real key[hse_cache_nkey];
+        hse_cache_key(adv, ie, idir, side, dxn, key);
 
-            amrex::ParallelFor(gbx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
-
-                Real dens_below = adv(domhi[0],j,k,URHO);
-                Real temp_below = adv(domhi[0],j,k,UTEMP);
-                Real X_zone[NumSpec];
-                for (int n = 0; n < NumSpec; n++) {
-                    X_zone[n] = adv(domhi[0],j,k,UFS+n) / dens_below;
-                }
+        const Real dens_edge = key[0];
+        const Real temp_edge = key[1];
+        const Real* X_zone = &key[5];
 #if NAUX_NET > 0
-                Real aux_zone[NumAux];
-                for (int n = 0; n < NumAux; n++) {
-                    aux_zone[n] = adv(domhi[0],j,k,UFX+n) / dens_below;
-                }
+        const Real* aux_zone = &key[5+NumSpec];
 #endif
 
-                // keep track of the density at the top of the domain
+        int slot = 0;
+        bool hit = false;
+
+        if (use_cache) {
+            slot = hse_cache_slot(key, mask);
+            hit = hse_cache_match(entries[slot], key, ng, tol);
+        }
 
-                Real dens_base = dens_below;
+        // keep track of the density at the edge of the domain
 
-                // get pressure in this zone (the initial below zone)
+        const Real dens_base = dens_edge;
 
-                eos_rep_t eos_state;
-                eos_state.rho = dens_below;
-                eos_state.T = temp_below;
-                for (int n = 0; n < NumSpec; n++) {
-                    eos_state.xn[n] = X_zone[n];
-                }
+        eos_rep_t eos_state;
+        eos_state.rho = dens_edge;
+        eos_state.T = temp_edge;
+        for (int n = 0; n < NumSpec; n++) {
+            eos_state.xn[n] = X_zone[n];
+        }
 #if NAUX_NET > 0
-                for (int n = 0; n < NumAux; n++) {
-                    eos_state.aux[n] = aux_zone[n];
-                }
+        for (int n = 0; n < NumAux; n++) {
+            eos_state.aux[n] = aux_zone[n];
+        }
 #endif
 
-                eos(eos_input_rt, eos_state);
-
-                Real pres_below = eos_state.p;
-
-                for (int ii = domhi[0]+1; ii <= adv_hi[0]; ii++) {
-
-                    // HSE integration to get density, pressure
-
-                    // initial guesses
-                    Real dens_zone = dens_below;
+        // get pressure in the edge zone, where the integration starts
 
-                    // temperature and species held constant in BCs
+        Real dens_prev = dens_edge;
+        Real pres_prev = 0.0_rt;
 
-                    Real temp_zone;
-                    if (hse_interp_temp == 1) {
-                        temp_zone = 2*adv(ii-1,j,k,UTEMP) - adv(ii-2,j,k,UTEMP);
-                    } else {
-                        temp_zone = temp_below;
-                    }
-
-                    bool converged_hse = false;
-
-                    Real p_want;
-                    Real drho;
+        if (!hit) {
+            eos(eos_input_rt, eos_state);
+            pres_prev = eos_state.p;
+        }
 
-                    for (int iter = 0; iter < hse::MAX_ITER; iter++) {
+        const int mom[3] = {UMX, UMY, UMZ};
 
-                        // pressure needed from HSE
-                        p_want = pres_below +
-                            dx[0] * 0.5_rt * (dens_zone + dens_below) * gravity::const_grav;
+        for (int m = 0; m < ng; m++) {
 
-                        // pressure from EOS
+            IntVect ig = ie;
+            ig[idir] = edge + side * (m+1);
 
-                        eos_state.rho = dens_zone;
-                        eos_state.T = temp_zone;
-                        // xn is already set above
+            Real dens_zone;
+            Real temp_zone;
+            Real eint;
 
-                        eos(eos_input_rt, eos_state);
+            if (hit) {
 
-                        Real pres_zone = eos_state.p;
-                        Real dpdr = eos_state.dpdr;
+                dens_zone = entries[slot].dens[m];
+                temp_zone = entries[slot].temp[m];
+                eint = entries[slot].eint[m];
 
-                        // Newton-Raphson - we want to zero A = p_want - p(rho)
-                        Real A = p_want - pres_zone;
-                        drho = A / (dpdr - 0.5_rt * dx[0] * gravity::const_grav);
+            } else {
 
-                        dens_zone = amrex::max(0.9_rt*dens_zone,
-                                               amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
+                // HSE integration to get density, pressure
 
-                        // convergence?
+                // initial guesses
 
-                        if (std::abs(drho) < hse::TOL * dens_zone) {
-                            converged_hse = true;
-                            break;
-                        }
+                dens_zone = dens_prev;
 
-                    }
-
-#ifndef AMREX_USE_GPU
-                   if (! converged_hse) {
-                       std::cout << "ii, j, k, domhi[0]: " << ii << " " << j << " " << k << " " << domhi[0] << std::endl;
-                       std::cout << "p_want:    " << p_want << std::endl;
-                       std::cout << "dens_zone: " << dens_zone << std::endl;
-                       std::cout << "temp_zone: " << temp_zone << std::endl;
-                       std::cout << "drho:      " << drho << std::endl;
-                       std::cout << std::endl;
-                       std::cout << "column info: " << std::endl;
-                       std::cout << "   dens: " << adv(ii,j,k,URHO) << std::endl;
-                       std::cout << "   temp: " << adv(ii,j,k,UTEMP) << std::endl;
-                       amrex::Error("ERROR in bc_ext_fill_nd: failure to converge in +X BC");
-                   }
-#endif
+                // temperature and species held constant in BCs
 
-                   // velocity
+                if (hse_interp_temp == 1) {
+                    IntVect i1 = ig;
+                    i1[idir] -= side;
+                    IntVect i2 = i1;
+                    i2[idir] -= side;
+                    temp_zone = 2*adv(i1,UTEMP) - adv(i2,UTEMP);
+                } else {
+                    temp_zone = temp_edge;
+                }
 
-                   if (hse_zero_vels == 1) {
+                bool converged_hse = false;
 
-                       // zero normal momentum causes pi waves to pass through
+                Real p_want;
+                Real drho;
 
-                       adv(ii,j,k,UMX) = 0.0_rt;
-                       adv(ii,j,k,UMY) = 0.0_rt;
-                       adv(ii,j,k,UMZ) = 0.0_rt;
+                for (int iter = 0; iter < hse::MAX_ITER; iter++) {
 
-                   } else {
+                    // pressure needed from HSE -- we integrate in the
+                    // direction of side
 
-                       if (hse_reflect_vels == 1) {
-                           // reflect normal, zero gradient for transverse
-                           // note: we need to match the corresponding
-                           // zone on the other side of the interface
-                           int ioff = ii-domhi[0]-1;
-                           adv(ii,j,k,UMX) = -dens_zone * (adv(domhi[0]-ioff,j,k,UMX) / adv(domhi[0]-ioff,j,k,URHO));
+                    p_want = pres_prev +
+                        side * dxn * 0.5_rt * (dens_zone + dens_prev) * gravity::const_grav;
 
-                           adv(ii,j,k,UMY) = -dens_zone * (adv(domhi[0],j,k,UMY) / dens_base);
-                           adv(ii,j,k,UMZ) = -dens_zone * (adv(domhi[0],j,k,UMZ) / dens_base);
-                       } else {
-                           // zero gradient
-                           adv(ii,j,k,UMX) = dens_zone * (adv(domhi[0],j,k,UMX) / dens_base);
-                           adv(ii,j,k,UMY) = dens_zone * (adv(domhi[0],j,k,UMY) / dens_base);
-                           adv(ii,j,k,UMZ) = dens_zone * (adv(domhi[0],j,k,UMZ) / dens_base);
-                       }
-                   }
+                    // pressure from EOS
 
-                   eos_state.rho = dens_zone;
-                   eos_state.T = temp_zone;
+                    eos_state.rho = dens_zone;
+                    eos_state.T = temp_zone;
+                    // xn is already set above
 
-                   eos(eos_input_rt, eos_state);
+                    eos(eos_input_rt, eos_state);
 
-                   Real pres_zone = eos_state.p;
-                   Real eint = eos_state.e;
+                    Real pres_zone = eos_state.p;
+                    Real dpdr = eos_state.dpdr;
 
-                   //  store the final state
+                    // Newton-Raphson - we want to zero A = p_want - p(rho)
+                    Real A = p_want - pres_zone;
+                    drho = A / (dpdr - side * 0.5_rt * dxn * gravity::const_grav);
 
-                   adv(ii,j,k,URHO) = dens_zone;
-                   adv(ii,j,k,UEINT) = dens_zone * eint;
-                   adv(ii,j,k,UEDEN) = dens_zone * eint +
-                       0.5_rt * (adv(ii,j,k,UMX) * adv(ii,j,k,UMX) +
-                                 adv(ii,j,k,UMY) * adv(ii,j,k,UMY) +
-                                 adv(ii,j,k,UMZ) * adv(ii,j,k,UMZ)) / dens_zone;
-                   adv(ii,j,k,UTEMP) = temp_zone;
-                   for (int n = 0; n < NumSpec; n++) {
-                       adv(ii,j,k,UFS+n) = dens_zone * X_zone[n];
-                   }
-#if NAUX_NET > 0
-                   for (int n = 0; n < NumAux; n++) {
-                       adv(ii,j,k,UFX+n) = dens_zone * aux_zone[n];
-                   }
-#endif
+                    dens_zone = amrex::max(0.9_rt*dens_zone,
+                                           amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
 
-                   // for the next zone
+                    // convergence?
 
-                   dens_below = dens_zone;
-                   pres_below = pres_zone;
+                    if (std::abs(drho) < hse::TOL * dens_zone) {
+                        converged_hse = true;
+                        break;
+                    }
 
                 }
-            });
-
-       }
-
-    }
-
-
-#if AMREX_SPACEDIM >= 2
-    //
-    // y boundaries
-    //
-
-    // YLO
-
-    if (bcr[URHO].lo(1) == EXT_DIR && lo[1] < domlo[1]) {
-
-        if (yl_ext_bc_type == EXT_HSE) {
 
-            Box gbx(IntVect(D_DECL(lo[0], domlo[1]-1, lo[2])),
-                    IntVect(D_DECL(hi[0], domlo[1]-1, hi[2])));
-
-            amrex::ParallelFor(gbx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
-
-                Real dens_above = adv(i,domlo[1],k,URHO);
-                Real temp_above = adv(i,domlo[1],k,UTEMP);
-                Real X_zone[NumSpec];
-                for (int n = 0; n < NumSpec; n++) {
-                    X_zone[n] = adv(i,domlo[1],k,UFS+n) / dens_above;
-                }
-#if NAUX_NET > 0
-                Real aux_zone[NumAux];
-                for (int n = 0; n < NumAux; n++) {
-                    aux_zone[n] = adv(i,domlo[1],k,UFX+n) / dens_above;
+#ifndef AMREX_USE_GPU
+                if (! converged_hse) {
+                    std::cout << "zone, edge: " << ig << " " << edge << std::endl;
+                    std::cout << "p_want:    " << p_want << std::endl;
+                    std::cout << "dens_zone: " << dens_zone << std::endl;
+                    std::cout << "temp_zone: " << temp_zone << std::endl;
+                    std::cout << "drho:      " << drho << std::endl;
+                    std::cout << std::endl;
+                    std::cout << "column info: " << std::endl;
+                    std::cout << "   dens: " << adv(ig,URHO) << std::endl;
+                    std::cout << "   temp: " << adv(ig,UTEMP) << std::endl;
+                    const char face[3] = {side < 0 ? '-' : '+', "XYZ"[idir], '\0'};
+                    amrex::Error(std::string("ERROR in bc_ext_fill_nd: failure to converge in ") +
+                                 face + " BC");
                 }
 #endif
 
-                // keep track of the density at the base of the domain
-
-                Real dens_base = dens_above;
-
-                // get pressure in this zone (the initial above zone)
-
-                eos_rep_t eos_state;
-                eos_state.rho = dens_above;
-                eos_state.T = temp_above;
-                for (int n = 0; n < NumSpec; n++) {
-                    eos_state.xn[n] = X_zone[n];
-                }
-#if NAUX_NET > 0
-                for (int n = 0; n < NumAux; n++) {
-                    eos_state.aux[n] = aux_zone[n];
-                }
-#endif
+                eos_state.rho = dens_zone;
+                eos_state.T = temp_zone;
 
                 eos(eos_input_rt, eos_state);
 
-                Real pres_above = eos_state.p;
-
-                for (int jj = domlo[1]-1; jj >= adv_lo[1]; jj--) {
-
-                    // HSE integration to get density, pressure
-
-                    // initial guesses
-
-                    Real dens_zone = dens_above;
-
-                    // temperature and species held constant in BCs
-
-                    Real temp_zone;
-                    if (hse_interp_temp == 1) {
-                        temp_zone = 2*adv(i,jj+1,k,UTEMP) - adv(i,jj+2,k,UTEMP);
-                    } else {
-                        temp_zone = temp_above;
-                    }
+                eint = eos_state.e;
 
-                    bool converged_hse = false;
-
-                    Real p_want;
-                    Real drho;
-
-                    for (int iter = 0; iter < hse::MAX_ITER; iter++) {
-
-                        // pressure needed from HSE
+                if (use_cache) {
+                    prof_arr(iv,m) = dens_zone;
+                    prof_arr(iv,ng+m) = temp_zone;
+                    prof_arr(iv,2*ng+m) = eint;
+                }
 
-                        p_want = pres_above -
-                            dx[1] * 0.5_rt * (dens_zone + dens_above) * gravity::const_grav;
+                // for the next zone
 
-                        // pressure from EOS
+                dens_prev = dens_zone;
+                pres_prev = eos_state.p;
+            }
 
-                        eos_state.rho = dens_zone;
-                        eos_state.T = temp_zone;
-                        // xn is already set above
+            // velocity
 
-                        eos(eos_input_rt, eos_state);
+            if (hse_zero_vels == 1) {
 
-                        Real pres_zone = eos_state.p;
-                        Real dpdr = eos_state.dpdr;
+                // zero normal momentum causes pi waves to pass through
 
-                        // Newton-Raphson - we want to zero A = p_want - p(rho)
-                        Real A = p_want - pres_zone;
-                        drho = A / (dpdr + 0.5_rt * dx[1] * gravity::const_grav);
+                for (int d = 0; d < 3; d++) {
+                    adv(ig,mom[d]) = 0.0_rt;
+                }
 
-                        dens_zone = amrex::max(0.9_rt*dens_zone,
-                                               amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
+            } else {
 
-                        // convergence?
+                if (hse_reflect_vels == 1) {
+                    // reflect normal, zero gradient for transverse
+                    // note: we need to match the corresponding
+                    // zone on the other side of the interface
+                    IntVect ir = ie;
+                    ir[idir] = edge - side * m;
 
-                        if (std::abs(drho) < hse::TOL * dens_zone) {
-                            converged_hse = true;
-                            break;
+                    for (int d = 0; d < 3; d++) {
+                        if (d == idir) {
+                            adv(ig,mom[d]) = -dens_zone * (adv(ir,mom[d]) / adv(ir,URHO));
+                        } else {
+                            adv(ig,mom[d]) = -dens_zone * (adv(ie,mom[d]) / dens_base);
                         }
-
                     }
-
-#ifndef AMREX_USE_GPU
-                   if (! converged_hse) {
-                       std::cout << "i, jj, k, domlo[1]: " << i << " " << jj << " " << k << " " << domlo[1] << std::endl;
-                       std::cout << "p_want:    " << p_want << std::endl;
-                       std::cout << "dens_zone: " << dens_zone << std::endl;
-                       std::cout << "temp_zone: " << temp_zone << std::endl;
-                       std::cout << "drho:      " << drho << std::endl;
-                       std::cout << std::endl;
-                       std::cout << "column info: " << std::endl;
-                       std::cout << "   dens: " << adv(i,jj,k,URHO) << std::endl;
-                       std::cout << "   temp: " << adv(i,jj,k,UTEMP) << std::endl;
-                       amrex::Error("ERROR in bc_ext_fill_nd: failure to converge in -Y BC");
-                   }
-#endif
-
-                   // velocity
-
-                   if (hse_zero_vels == 1) {
-
-                       // zero normal momentum causes pi waves to pass through
-
-                       adv(i,jj,k,UMX) = 0.0_rt;
-                       adv(i,jj,k,UMY) = 0.0_rt;
-                       adv(i,jj,k,UMZ) = 0.0_rt;
-
-                   } else {
-
-                       if (hse_reflect_vels == 1) {
-                           // reflect normal, zero gradient for transverse
-                           // note: we need to match the corresponding
-                           // zone on the other side of the interface
-                           int joff = domlo[1]-jj-1;
-                           adv(i,jj,k,UMY) = -dens_zone*(adv(i,domlo[1]+joff,k,UMY) / adv(i,domlo[1]+joff,k,URHO));
-
-                           adv(i,jj,k,UMX) = -dens_zone*(adv(i,domlo[1],k,UMX) / dens_base);
-                           adv(i,jj,k,UMZ) = -dens_zone*(adv(i,domlo[1],k,UMZ) / dens_base);
-                       } else {
-                           // zero gradient
-                           adv(i,jj,k,UMX) = dens_zone * (adv(i,domlo[1],k,UMX) / dens_base);
-                           adv(i,jj,k,UMY) = dens_zone * (adv(i,domlo[1],k,UMY) / dens_base);
-                           adv(i,jj,k,UMZ) = dens_zone * (adv(i,domlo[1],k,UMZ) / dens_base);
-                       }
-                   }
-
-                   eos_state.rho = dens_zone;
-                   eos_state.T = temp_zone;
-
-                   eos(eos_input_rt, eos_state);
-
-                   Real pres_zone = eos_state.p;
-                   Real eint = eos_state.e;
-
-                   // store the final state
-
-                   adv(i,jj,k,URHO) = dens_zone;
-                   adv(i,jj,k,UEINT) = dens_zone * eint;
-                   adv(i,jj,k,UEDEN) = dens_zone * eint +
-                       0.5_rt * (adv(i,jj,k,UMX) * adv(i,jj,k,UMX) +
-                                 adv(i,jj,k,UMY) * adv(i,jj,k,UMY) +
-                                 adv(i,jj,k,UMZ) * adv(i,jj,k,UMZ)) / dens_zone;
-                   adv(i,jj,k,UTEMP) = temp_zone;
-                   for (int n = 0; n < NumSpec; n++) {
-                       adv(i,jj,k,UFS+n) = dens_zone * X_zone[n];
-                   }
+                } else {
+                    // zero gradient
+                    for (int d = 0; d < 3; d++) {
+                        adv(ig,mom[d]) = dens_zone * (adv(ie,mom[d]) / dens_base);
+                    }
+                }
+            }
+
+            // store the final state
+
+            adv(ig,URHO) = dens_zone;
+            adv(ig,UEINT) = dens_zone * eint;
+            adv(ig,UEDEN) = dens_zone * eint +
+                0.5_rt * (adv(ig,UMX) * adv(ig,UMX) +
+                          adv(ig,UMY) * adv(ig,UMY) +
+                          adv(ig,UMZ) * adv(ig,UMZ)) / dens_zone;
+            adv(ig,UTEMP) = temp_zone;
+            for (int n = 0; n < NumSpec; n++) {
+                adv(ig,UFS+n) = dens_zone * X_zone[n];
+            }
 #if NAUX_NET > 0
-                   for (int n = 0; n < NumAux; n++) {
-                       adv(i,jj,k,UFX+n) = dens_zone * aux_zone[n];
-                   }
+            for (int n = 0; n < NumAux; n++) {
+                adv(ig,UFX+n) = dens_zone * aux_zone[n];
+            }
 #endif
 
-                   // for the next zone
-
-                   dens_above = dens_zone;
-                   pres_above = pres_zone;
+        }
 
-                }
-            });
+        // of the columns that missed in a slot, the last one gets to
+        // insert its profile
 
-       }
+        if (use_cache && !hit) {
+            Gpu::Atomic::Max(&winner[slot], static_cast<int>(gbx.index(iv)));
+        }
 
+        return {hit ? 1 : 0};
+    });
 
+    if (!use_cache) {
+        return;
     }
 
+    ReduceTuple hv = reduce_data.value();
+    const int nhit = amrex::get<0>(hv);
 
-    // YHI
+    amrex::ParallelFor(gbx,
+    [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+    {
+        const IntVect iv(AMREX_D_DECL(i, j, k));
 
-    if (bcr[URHO].hi(1) == EXT_DIR && hi[1] > domhi[1]) {
-
-        if (yr_ext_bc_type == EXT_HSE) {
+        IntVect ie = iv;
+        ie[idir] = edge;
 
-            Box gbx(IntVect(D_DECL(lo[0], domhi[1]+1, lo[2])),
-                    IntVect(D_DECL(hi[0], domhi[1]+1, hi[2])));
+        Real key[hse_cache_nkey];
+        hse_cache_key(adv, ie, idir, side, dxn, key);
 
-            amrex::ParallelFor(gbx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
+        const int slot = hse_cache_slot(key, mask);
 
-                Real dens_below = adv(i,domhi[1],k,URHO);
-                Real temp_below = adv(i,domhi[1],k,UTEMP);
-                Real X_zone[NumSpec];
-                for (int n = 0; n < NumSpec; n++) {
-                    X_zone[n] = adv(i,domhi[1],k,UFS+n) / dens_below;
-                }
-#if NAUX_NET > 0
-                Real aux_zone[NumAux];
-                for (int n = 0; n < NumAux; n++) {
-                    aux_zone[n] = adv(i,domhi[1],k,UFX+n) / dens_below;
-                }
-#endif
+        if (winner[slot] != static_cast<int>(gbx.index(iv))) {
+            return;
+        }
 
-                // keep track of the density at the base of the domain
+        HSECacheEntry& entry = entries[slot];
 
-                Real dens_base = dens_below;
+        for (int n = 0; n < hse_cache_nkey; n++) {
+            entry.key[n] = key[n];
+        }
+        for (int m = 0; m < ng; m++) {
+            entry.dens[m] = prof_arr(iv,m);
+            entry.temp[m] = prof_arr(iv,ng+m);
+            entry.eint[m] = prof_arr(iv,2*ng+m);
+        }
+        entry.nghost = ng;
 
-                // get pressure in this zone (the initial below zone)
+        winner[slot] = -1;
+    });
 
-                eos_rep_t eos_state;
-                eos_state.rho = dens_below;
-                eos_state.T = temp_below;
-                for (int n = 0; n < NumSpec; n++) {
-                    eos_state.xn[n] = X_zone[n];
-                }
-#if NAUX_NET > 0
-                for (int n = 0; n < NumAux; n++) {
-                    eos_state.aux[n] = aux_zone[n];
-                }
+#ifdef _OPENMP
+#pragma omp atomic
 #endif
+    hse_cache_hits += nhit;
 
-                eos(eos_input_rt, eos_state);
-
-                Real pres_below = eos_state.p;
-
-                for (int jj = domhi[1]+1; jj <= adv_hi[1]; jj++) {
-
-                    // HSE integration to get density, pressure
-
-                    // initial guesses
-                    Real dens_zone = dens_below;
-
-                    // temperature and species held constant in BCs
-
-                    Real temp_zone;
-                    if (hse_interp_temp == 1) {
-                        temp_zone = 2*adv(i,jj-1,k,UTEMP) - adv(i,jj-2,k,UTEMP);
-                    } else {
-                        temp_zone = temp_below;
-                    }
-
-                    bool converged_hse = false;
-
-                    Real p_want;
-                    Real drho;
-
-                    for (int iter = 0; iter < hse::MAX_ITER; iter++) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    hse_cache_columns += gbx.numPts();
 
-                        // pressure needed from HSE
-                        p_want = pres_below +
-                            dx[1] * 0.5_rt * (dens_zone + dens_below) * gravity::const_grav;
+}
 
-                        // pressure from EOS
 
-                        eos_state.rho = dens_zone;
-                        eos_state.T = temp_zone;
-                        // xn is already set above
+void
+hse_fill(const Box& bx, Array4<Real> const& adv,
+              Geometry const& geom, const Vector<BCRec>& bcr,
+              const Real time)
+{
 
-                        eos(eos_input_rt, eos_state);
+    amrex::ignore_unused(time);
 
-                        Real pres_zone = eos_state.p;
-                        Real dpdr = eos_state.dpdr;
+    auto domlo = geom.Domain().loVect3d();
+    auto domhi = geom.Domain().hiVect3d();
 
-                        // Newton-Raphson - we want to zero A = p_want - p(rho)
-                        Real A = p_want - pres_zone;
-                        drho = A / (dpdr - 0.5_rt * dx[1] * gravity::const_grav);
+    auto lo = bx.loVect();
+    auto hi = bx.hiVect();
 
-                        dens_zone = amrex::max(0.9_rt*dens_zone,
-                                               amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
+    //
+    // x boundaries
+    //
 
-                        // convergence?
+    // XLO
 
-                        if (std::abs(drho) < hse::TOL * dens_zone) {
-                            converged_hse = true;
-                            break;
-                        }
+    if (bcr[URHO].lo(0) == EXT_DIR && lo[0] < domlo[0]) {
 
-                    }
+        if (xl_ext_bc_type == EXT_HSE) {
+            hse_fill_face(bx, adv, geom, 0, -1);
+        }
 
-#ifndef AMREX_USE_GPU
-                   if (! converged_hse) {
-                       std::cout << "i, jj, k, domhi[1]: " << i << " " << jj << " " << k << " " << domhi[1] << std::endl;
-                       std::cout << "p_want:    " << p_want << std::endl;
-                       std::cout << "dens_zone: " << dens_zone << std::endl;
-                       std::cout << "temp_zone: " << temp_zone << std::endl;
-                       std::cout << "drho:      " << drho << std::endl;
-                       std::cout << std::endl;
-                       std::cout << "column info: " << std::endl;
-                       std::cout << "   dens: " << adv(i,jj,k,URHO) << std::endl;
-                       std::cout << "   temp: " << adv(i,jj,k,UTEMP) << std::endl;
-                       amrex::Error("ERROR in bc_ext_fill_nd: failure to converge in +Y BC");
-                   }
-#endif
+    }
 
-                   // velocity
 
-                   if (hse_zero_vels == 1) {
+    // XHI
 
-                       // zero normal momentum causes pi waves to pass through
+    if (bcr[URHO].hi(0) == EXT_DIR && hi[0] > domhi[0]) {
 
-                       adv(i,jj,k,UMX) = 0.0_rt;
-                       adv(i,jj,k,UMY) = 0.0_rt;
-                       adv(i,jj,k,UMZ) = 0.0_rt;
+        if (xr_ext_bc_type == EXT_HSE) {
+            hse_fill_face(bx, adv, geom, 0, 1);
+        }
 
-                   } else {
+    }
 
-                       if (hse_reflect_vels == 1) {
-                           // reflect normal, zero gradient for transverse
-                           // note: we need to match the corresponding
-                           // zone on the other side of the interface
-                           int joff = jj-domhi[1]-1;
-                           adv(i,jj,k,UMY) = -dens_zone * (adv(i,domhi[1]-joff,k,UMY) / adv(i,domhi[1]-joff,k,URHO));
 
-                           adv(i,jj,k,UMX) = -dens_zone * (adv(i,domhi[1],k,UMX) / dens_base);
-                           adv(i,jj,k,UMZ) = -dens_zone * (adv(i,domhi[1],k,UMZ) / dens_base);
-                       } else {
-                           // zero gradient
-                           adv(i,jj,k,UMX) = dens_zone * (adv(i,domhi[1],k,UMX) / dens_base);
-                           adv(i,jj,k,UMY) = dens_zone * (adv(i,domhi[1],k,UMY) / dens_base);
-                           adv(i,jj,k,UMZ) = dens_zone * (adv(i,domhi[1],k,UMZ) / dens_base);
-                       }
-                   }
+#if AMREX_SPACEDIM >= 2
+    //
+    // y boundaries
+    //
 
-                   eos_state.rho = dens_zone;
-                   eos_state.T = temp_zone;
+    // YLO
 
-                   eos(eos_input_rt, eos_state);
+    if (bcr[URHO].lo(1) == EXT_DIR && lo[1] < domlo[1]) {
 
-                   Real pres_zone = eos_state.p;
-                   Real eint = eos_state.e;
+        if (yl_ext_bc_type == EXT_HSE) {
+            hse_fill_face(bx, adv, geom, 1, -1);
+        }
 
-                   // store the final state
+    }
 
-                   adv(i,jj,k,URHO) = dens_zone;
-                   adv(i,jj,k,UEINT) = dens_zone * eint;
-                   adv(i,jj,k,UEDEN) = dens_zone * eint +
-                       0.5_rt * (adv(i,jj,k,UMX) * adv(i,jj,k,UMX) +
-                                 adv(i,jj,k,UMY) * adv(i,jj,k,UMY) +
-                                 adv(i,jj,k,UMZ) * adv(i,jj,k,UMZ)) / dens_zone;
-                   adv(i,jj,k,UTEMP) = temp_zone;
-                   for (int n = 0; n < NumSpec; n++) {
-                       adv(i,jj,k,UFS+n) = dens_zone * X_zone[n];
-                   }
-#if NAUX_NET > 0
-                   for (int n = 0; n < NumAux; n++) {
-                       adv(i,jj,k,UFX+n) = dens_zone * aux_zone[n];
-                   }
-#endif
 
-                   // for the next zone
+    // YHI
 
-                   dens_below = dens_zone;
-                   pres_below = pres_zone;
+    if (bcr[URHO].hi(1) == EXT_DIR && hi[1] > domhi[1]) {
 
-                }
-            });
+        if (yr_ext_bc_type == EXT_HSE) {
+            hse_fill_face(bx, adv, geom, 1, 1);
         }
 
     }
 #endif
 
+
 #if AMREX_SPACEDIM == 3
     //
     // z boundaries
@@ -801,182 +600,7 @@ hse_fill(const Box& bx, Array4<Real> const& adv,
     if (bcr[URHO].lo(2) == EXT_DIR && lo[2] < domlo[2]) {
 
         if (zl_ext_bc_type == EXT_HSE) {
-
-            Box gbx(IntVect(D_DECL(lo[0], lo[1], domlo[2]-1)),
-                    IntVect(D_DECL(hi[0], hi[1], domlo[2]-1)));
-
-            amrex::ParallelFor(gbx,
-            [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-            {
-
-                Real dens_above = adv(i,j,domlo[2],URHO);
-                Real temp_above = adv(i,j,domlo[2],UTEMP);
-                Real X_zone[NumSpec];
-                for (int n = 0; n < NumSpec; n++) {
-                    X_zone[n] = adv(i,j,domlo[2],UFS+n) / dens_above;
-                }
-#if NAUX_NET > 0
-                Real aux_zone[NumAux];
-                for (int n = 0; n < NumAux; n++) {
-                    aux_zone[n] = adv(i,j,domlo[2],UFX+n) / dens_above;
-                }
-#endif
-
-                // keep track of the density at the base of the domain
-
-                Real dens_base = dens_above;
-
-                // get pressure in this zone (the initial above zone)
-
-                eos_rep_t eos_state;
-                eos_state.rho = dens_above;
-                eos_state.T = temp_above;
-                for (int n = 0; n < NumSpec; n++) {
-                    eos_state.xn[n] = X_zone[n];
-                }
-#if NAUX_NET > 0
-                for (int n = 0; n < NumAux; n++) {
-                    eos_state.aux[n] = aux_zone[n];
-                }
-#endif
-
-                eos(eos_input_rt, eos_state);
-
-                Real pres_above = eos_state.p;
-
-                for (int kk = domlo[2]-1; kk >= adv_lo[2]; kk--) {
-
-                    // HSE integration to get density, pressure
-
-                    // initial guesses
-
-                    Real dens_zone = dens_above;
-
-                    // temperature and species held constant in BCs
-
-                    Real temp_zone;
-                    if (hse_interp_temp == 1) {
-                        temp_zone = 2*adv(i,j,kk+1,UTEMP) - adv(i,j,kk+2,UTEMP);
-                    } else {
-                        temp_zone = temp_above;
-                    }
-
-                    bool converged_hse = false;
-
-                    Real p_want;
-                    Real drho;
-
-                    for (int iter = 0; iter < hse::MAX_ITER; iter++) {
-
-                        // pressure needed from HSE
-
-                        p_want = pres_above -
-                            dx[2] * 0.5_rt * (dens_zone + dens_above) * gravity::const_grav;
-
-                        // pressure from EOS
-
-                        eos_state.rho = dens_zone;
-                        eos_state.T = temp_zone;
-                        // xn is already set above
-
-                        eos(eos_input_rt, eos_state);
-
-                        Real pres_zone = eos_state.p;
-                        Real dpdr = eos_state.dpdr;
-
-                        // Newton-Raphson - we want to zero A = p_want - p(rho)
-                        Real A = p_want - pres_zone;
-                        drho = A / (dpdr + 0.5_rt * dx[2] * gravity::const_grav);
-
-                        dens_zone = amrex::max(0.9_rt*dens_zone,
-                                               amrex::min(dens_zone + drho, 1.1_rt*dens_zone));
-
-                        // convergence?
-
-                        if (std::abs(drho) < hse::TOL * dens_zone) {
-                            converged_hse = true;
-                            break;
-                        }
-
-                    }
-
-#ifndef AMREX_USE_GPU
-                   if (! converged_hse) {
-                       std::cout << "i, j, kk, domlo[2]: " << i << " " << j << " " << kk << " " << domlo[2] << std::endl;
-                       std::cout << "p_want:    " << p_want << std::endl;
-                       std::cout << "dens_zone: " << dens_zone << std::endl;
-                       std::cout << "temp_zone: " << temp_zone << std::endl;
-                       std::cout << "drho:      " << drho << std::endl;
-                       std::cout << std::endl;
-                       std::cout << "column info: " << std::endl;
-                       std::cout << "   dens: " << adv(i,j,kk,URHO) << std::endl;
-                       std::cout << "   temp: " << adv(i,j,kk,UTEMP) << std::endl;
-                       amrex::Error("ERROR in bc_ext_fill_nd: failure to converge in -Z BC");
-                   }
-#endif
-
-                   // velocity
-
-                   if (hse_zero_vels == 1) {
-
-                       // zero normal momentum causes pi waves to pass through
-
-                       adv(i,j,kk,UMX) = 0.0_rt;
-                       adv(i,j,kk,UMY) = 0.0_rt;
-                       adv(i,j,kk,UMZ) = 0.0_rt;
-
-                   } else {
-
-                       if (hse_reflect_vels == 1) {
-                           // reflect normal, zero gradient for transverse
-                           // note: we need to match the corresponding
-                           // zone on the other side of the interface
-                           int koff = domlo[2]-kk-1;
-                           adv(i,j,kk,UMZ) = -dens_zone * (adv(i,j,domlo[2]+koff,UMZ) / adv(i,j,domlo[2]+koff,URHO));
-
-                           adv(i,j,kk,UMX) = -dens_zone * (adv(i,j,domlo[2],UMX) / dens_base);
-                           adv(i,j,kk,UMY) = -dens_zone * (adv(i,j,domlo[2],UMY) / dens_base);
-                       } else {
-                           // zero gradient
-                           adv(i,j,kk,UMX) = dens_zone * (adv(i,j,domlo[2],UMX) / dens_base);
-                           adv(i,j,kk,UMY) = dens_zone * (adv(i,j,domlo[2],UMY) / dens_base);
-                           adv(i,j,kk,UMZ) = dens_zone * (adv(i,j,domlo[2],UMZ) / dens_base);
-                       }
-                   }
-
-                   eos_state.rho = dens_zone;
-                   eos_state.T = temp_zone;
-
-                   eos(eos_input_rt, eos_state);
-
-                   Real pres_zone = eos_state.p;
-                   Real eint = eos_state.e;
-
-                   // store the final state
-
-                   adv(i,j,kk,URHO) = dens_zone;
-                   adv(i,j,kk,UEINT) = dens_zone * eint;
-                   adv(i,j,kk,UEDEN) = dens_zone * eint +
-                       0.5_rt * (adv(i,j,kk,UMX) * adv(i,j,kk,UMX) +
-                                 adv(i,j,kk,UMY) * adv(i,j,kk,UMY) +
-                                 adv(i,j,kk,UMZ) * adv(i,j,kk,UMZ)) / dens_zone;
-                   adv(i,j,k,UTEMP) = temp_zone;
-                   for (int n = 0; n < NumSpec; n++) {
-                       adv(i,j,kk,UFS+n) = dens_zone * X_zone[n];
-                   }
-#if NAUX_NET > 0
-                   for (int n = 0; n < NumAux; n++) {
-                       adv(i,j,kk,UFX+n) = dens_zone * aux_zone[n];
-                   }
-#endif
-
-                   // for the next zone
-
-                   dens_above = dens_zone;
-                   pres_above = pres_zone;
-
-                }
-            });
+            hse_fill_face(bx, adv, geom, 2, -1);
         }
 
     }
@@ -996,4 +620,28 @@ hse_fill(const Box& bx, Array4<Real> const& adv,
 }
 
 
+void
+hse_fill_cache_report ()
+{
+
+    if (hse_fill_cache != 1) {
+        return;
+    }
+
+    Long counts[2] = {hse_cache_hits, hse_cache_columns};
+
+#ifdef BL_LAZY
+    Lazy::QueueReduction( [=] () mutable {
+#endif
+        ParallelDescriptor::ReduceLongSum(counts, 2, ParallelDescriptor::IOProcessorNumber());
 
+        if (ParallelDescriptor::IOProcessor() && counts[1] > 0) {
+            std::cout << "HSE boundary fill: " << counts[0] << " of " << counts[1]
+                      << " columns (" << 100.0 * static_cast<Real>(counts[0]) / static_cast<Real>(counts[1])
+                      << "%) served from the cache" << std::endl;
+        }
+#ifdef BL_LAZY
+    });
+#endif
+
+}
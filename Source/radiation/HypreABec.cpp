@@ -205,6 +205,10 @@ HypreABec::HypreABec(const BoxArray& grids,
 
 HypreABec::~HypreABec()
 {
+  if (solver_is_setup) {
+    clearSolver();
+  }
+
   HYPRE_StructVectorDestroy(b);
   HYPRE_StructVectorDestroy(x);
 
@@ -916,9 +920,9 @@ void HypreABec::hbmat3 (const Box& bx,
     Gpu::synchronize();
 }
 
-void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
+void HypreABec::loadMatrix()
 {
-  BL_PROFILE("HypreABec::setupSolver");
+  BL_PROFILE("HypreABec::loadMatrix");
 
   const BoxArray& grids = acoefs->boxArray();
 
@@ -998,6 +1002,13 @@ void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
 
   HYPRE_StructVectorAssemble(b); // currently a no-op
   HYPRE_StructVectorAssemble(x); // currently a no-op
+}
+
+void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
+{
+  BL_PROFILE("HypreABec::setupSolver");
+
+  loadMatrix();
 
   reltol = _reltol;
   abstol = _abstol; // may be used to change tolerance for solve
@@ -1130,12 +1141,16 @@ void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
       amrex::Error("HypreABec: no such solver");
   }
   Gpu::synchronize();
+
+  solver_is_setup = true;
 }
 
 void HypreABec::clearSolver()
 {
   BL_PROFILE("HypreABec::clearSolver");
 
+  solver_is_setup = false;
+
   if (solver_flag == 0) {
     HYPRE_StructSMGDestroy(solver);
   }
@@ -1794,19 +1809,22 @@ void HypreABec::solve(MultiFab& dest, int icomp, MultiFab& rhs, BC_Mode inhom)
                        ? abstol / bnorm * sqrt(volume)
                        : reltol);
 
-    if (reltol_new > reltol) {
-      if (solver_flag == 0) {
-        HYPRE_StructSMGSetTol(solver, reltol_new);
-      }
-      else if(solver_flag == 1) {
-        HYPRE_StructPFMGSetTol(solver, reltol_new);
-      }
-      else if(solver_flag == 2) {
-        // nothing for this option
-      }
-      else if(solver_flag == 3 || solver_flag == 4) {
-        HYPRE_StructPCGSetTol(solver, reltol_new);
-      }
+    // Always set the tolerance, since a solver that is kept between
+    // solves may still have a looser one from an earlier rhs.
+
+    reltol_new = std::max(reltol_new, reltol);
+
+    if (solver_flag == 0) {
+      HYPRE_StructSMGSetTol(solver, reltol_new);
+    }
+    else if(solver_flag == 1) {
+      HYPRE_StructPFMGSetTol(solver, reltol_new);
+    }
+    else if(solver_flag == 2) {
+      // nothing for this option
+    }
+    else if(solver_flag == 3 || solver_flag == 4) {
+      HYPRE_StructPCGSetTol(solver, reltol_new);
     }
   }
 
@@ -1894,6 +1912,29 @@ void HypreABec::solve(MultiFab& dest, int icomp, MultiFab& rhs, BC_Mode inhom)
   Gpu::synchronize();
 }
 
+int HypreABec::getNumIterations()
+{
+  int num_iterations = 0;
+
+  if (solver_flag == 0) {
+    HYPRE_StructSMGGetNumIterations(solver, &num_iterations);
+  }
+  else if (solver_flag == 1) {
+    HYPRE_StructPFMGGetNumIterations(solver, &num_iterations);
+  }
+  else if (solver_flag == 2) {
+    HYPRE_StructJacobiGetNumIterations(solver, &num_iterations);
+  }
+  else if (solver_flag == 3 || solver_flag == 4) {
+    HYPRE_StructPCGGetNumIterations(solver, &num_iterations);
+  }
+  else if (solver_flag == 5 || solver_flag == 6) {
+    HYPRE_StructHybridGetNumIterations(solver, &num_iterations);
+  }
+
+  return num_iterations;
+}
+
 Real HypreABec::getAbsoluteResidual()
 {
   BL_PROFILE("HypreABec::getAbsoluteResidual");
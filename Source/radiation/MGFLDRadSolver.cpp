@@ -573,6 +573,8 @@ void Radiation::MGFLD_implicit_update(int level, int iteration, int ncycle)
       save_lab_flux_in_plotvar(level, S_new, lambda, Er_new, *flxcc, icomp_flux);
   }
 
+  solver->reportSolverTimes(level);
+
   if (verbose) {
       amrex::Print() << "                                     done" << std::endl;
   }
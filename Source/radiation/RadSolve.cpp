@@ -8,7 +8,9 @@
 #include <rad_util.H>
 #include <problem_rad_source.H>
 #include <RAD_F.H>
+#ifdef AMREX_USE_HYPRE
 #include <HABEC_F.H>    // only for nonsymmetric flux; may be changed?
+#endif
 
 #include <iostream>
 
@@ -18,12 +20,28 @@
 
 using namespace amrex;
 
+// Keep a copy of a coefficient MultiFab for the MLMG backend,
+// reallocating only if the layout changed.
+static void keep_coeffs (std::unique_ptr<MultiFab>& dst, const MultiFab& src)
+{
+    if (!dst || dst->boxArray() != src.boxArray() ||
+        dst->DistributionMap() != src.DistributionMap()) {
+        dst.reset(new MultiFab(src.boxArray(), src.DistributionMap(), 1, 0));
+    }
+    MultiFab::Copy(*dst, src, 0, 0, 1, 0);
+}
+
 RadSolve::RadSolve (Amr* Parent, int level, const BoxArray& grids, const DistributionMapping& dmap)
     : parent(Parent)
 {
     read_params();
 
-    if (radsolve::level_solver_flag < 100) {
+    if (radsolve::level_solver_flag == 200) {
+        // AMReX MLMG; the operator is built for each solve in setupMLMG.
+        use_mlmg = true;
+    }
+#ifdef AMREX_USE_HYPRE
+    else if (radsolve::level_solver_flag < 100) {
         hd.reset(new HypreABec(grids, dmap, parent->Geom(level), radsolve::level_solver_flag));
     }
     else {
@@ -43,6 +61,7 @@ RadSolve::RadSolve (Amr* Parent, int level, const BoxArray& grids, const Distrib
             hem->buildMatrixStructure();
         }
     }
+#endif
 }
 
 void
@@ -85,19 +104,29 @@ RadSolve::read_params ()
     if (Radiation::SolverType == Radiation::SGFLDSolver
         && Radiation::Er_Lorentz_term) { 
 
-        if (radsolve::level_solver_flag < 100) {
-            amrex::Error("To do Lorentz term implicitly level_solver_flag must be >= 100.");
+        if (radsolve::level_solver_flag < 100 || radsolve::level_solver_flag == 200) {
+            amrex::Error("To do Lorentz term implicitly level_solver_flag must be >= 100 and not 200.");
         }
     }
 
     if (Radiation::SolverType == Radiation::MGFLDSolver && 
         Radiation::accelerate == 2 && Radiation::nGroups > 1) {
 
-        if (radsolve::level_solver_flag < 100) {
-            amrex::Error("When accelerate is 2, level_solver_flag must be >= 100.");
+        if (radsolve::level_solver_flag < 100 || radsolve::level_solver_flag == 200) {
+            amrex::Error("When accelerate is 2, level_solver_flag must be >= 100 and not 200.");
         }
     }
 
+    if (radsolve::level_solver_flag == 200 && radsolve::use_hypre_nonsymmetric_terms != 0) {
+        amrex::Error("radsolve.level_solver_flag = 200 does not support the nonsymmetric terms");
+    }
+
+#ifndef AMREX_USE_HYPRE
+    if (radsolve::level_solver_flag != 200) {
+        amrex::Error("Castro was built without Hypre; radsolve.level_solver_flag must be 200");
+    }
+#endif
+
 }
 
 void RadSolve::levelInit(int level)
@@ -109,6 +138,7 @@ void RadSolve::levelBndry(RadBndry& bd)
 {
   BL_PROFILE("RadSolve::levelBndry");
 
+#ifdef AMREX_USE_HYPRE
   if (hd) {
     hd->setBndry(bd);
   }
@@ -118,6 +148,14 @@ void RadSolve::levelBndry(RadBndry& bd)
   else if (hem) {
     hem->setBndry(hem->crseLevel(), bd);
   }
+  else
+#endif
+  if (use_mlmg) {
+    mlmg_bndry = &bd;
+    mlmg_bdcomp = 0;
+    mlmg_bndry_time = RadBndry::getTime();
+    mlmg_correction = RadBndry::inCorrection();
+  }
 }
 
 // update multigroup version
@@ -125,6 +163,7 @@ void RadSolve::levelBndry(MGRadBndry& mgbd, const int comp)
 {
   BL_PROFILE("RadSolve::levelBndryMG (updated)");
 
+#ifdef AMREX_USE_HYPRE
   if (hd) {
     hd->setBndry(mgbd, comp);
   }
@@ -134,6 +173,14 @@ void RadSolve::levelBndry(MGRadBndry& mgbd, const int comp)
   else if (hem) {
     hem->setBndry(hem->crseLevel(), mgbd, comp);
   }
+  else
+#endif
+  if (use_mlmg) {
+    mlmg_bndry = &mgbd;
+    mlmg_bdcomp = comp;
+    mlmg_bndry_time = MGRadBndry::getTime();
+    mlmg_correction = MGRadBndry::inCorrection();
+  }
 }
 
 void RadSolve::cellCenteredApplyMetrics(int level, MultiFab& cc)
@@ -165,6 +212,7 @@ void RadSolve::cellCenteredApplyMetrics(int level, MultiFab& cc)
 
 void RadSolve::setLevelACoeffs(int level, const MultiFab& acoefs)
 {
+#ifdef AMREX_USE_HYPRE
     if (hd) {
         hd->aCoefficients(acoefs);
     }
@@ -174,10 +222,16 @@ void RadSolve::setLevelACoeffs(int level, const MultiFab& acoefs)
     else if (hem) {
         hem->aCoefficients(level, acoefs);
     }
+    else
+#endif
+    if (use_mlmg) {
+        keep_coeffs(mlmg_acoefs, acoefs);
+    }
 }
 
 void RadSolve::setLevelBCoeffs(int level, const MultiFab& bcoefs, int dir)
 {
+#ifdef AMREX_USE_HYPRE
     if (hd) {
         hd->bCoefficients(bcoefs, dir);
     }
@@ -187,13 +241,20 @@ void RadSolve::setLevelBCoeffs(int level, const MultiFab& bcoefs, int dir)
     else if (hem) {
         hem->bCoefficients(level, bcoefs, dir);
     }
+    else
+#endif
+    if (use_mlmg) {
+        keep_coeffs(mlmg_bcoefs[dir], bcoefs);
+    }
 }
 
 void RadSolve::setLevelCCoeffs(int level, const MultiFab& ccoefs, int dir)
 {
+#ifdef AMREX_USE_HYPRE
     if (hem) {
       hem->cCoefficients(level, ccoefs, dir);
     }
+#endif
 }
 
 void RadSolve::levelACoeffs(int level,
@@ -242,6 +303,7 @@ void RadSolve::levelACoeffs(int level,
       });
   }
 
+#ifdef AMREX_USE_HYPRE
   if (hd) {
     hd->aCoefficients(acoefs);
   }
@@ -251,6 +313,11 @@ void RadSolve::levelACoeffs(int level,
   else if (hem) {
     hem->aCoefficients(level, acoefs);
   }
+  else
+#endif
+  if (use_mlmg) {
+    keep_coeffs(mlmg_acoefs, acoefs);
+  }
 }
 
 void RadSolve::levelSPas(int level, Array<MultiFab, AMREX_SPACEDIM>& lambda, int igroup, 
@@ -327,6 +394,7 @@ void RadSolve::levelSPas(int level, Array<MultiFab, AMREX_SPACEDIM>& lambda, int
       }
   }
 
+#ifdef AMREX_USE_HYPRE
   if (hm) {
     hm->SPalpha(level, spa);
   }
@@ -336,6 +404,11 @@ void RadSolve::levelSPas(int level, Array<MultiFab, AMREX_SPACEDIM>& lambda, int
   else if (hd) {
     hd->SPalpha(spa);
   }
+  else
+#endif
+  if (use_mlmg) {
+    keep_coeffs(mlmg_spa, spa);
+  }
   else {
     amrex::Abort("Should not be in RadSolve::levelSPas");    
   }
@@ -411,6 +484,7 @@ void RadSolve::levelBCoeffs(int level,
         });
     }
 
+#ifdef AMREX_USE_HYPRE
     if (hd) {
         hd->bCoefficients(bcoefs, idim);
     }
@@ -420,6 +494,11 @@ void RadSolve::levelBCoeffs(int level,
     else if (hem) {
       hem->bCoefficients(level, bcoefs, idim);
     }
+    else
+#endif
+    if (use_mlmg) {
+      keep_coeffs(mlmg_bcoefs[idim], bcoefs);
+    }
   } // -->> over dimension
 }
 
@@ -509,8 +588,10 @@ void RadSolve::levelDCoeffs(int level, Array<MultiFab, AMREX_SPACEDIM>& lambda,
             });
         }
 
+#ifdef AMREX_USE_HYPRE
         hem->d2Coefficients(level, dcoefs, idim);
         hem->d2Multiplier() = 1.0;
+#endif
     }
 }
 
@@ -595,6 +676,7 @@ void RadSolve::levelSolve(int level,
   BL_PROFILE("RadSolve::levelSolve");
 
   // Set coeffs, build solver, solve
+#ifdef AMREX_USE_HYPRE
   if (hd) {
     hd->setScalars(radsolve::alpha, radsolve::beta);
   }
@@ -604,10 +686,47 @@ void RadSolve::levelSolve(int level,
   else if (hem) {
     hem->setScalars(radsolve::alpha, radsolve::beta);
   }
+#endif
+
+  Real strt_time = ParallelDescriptor::second();
 
+#ifdef AMREX_USE_HYPRE
   if (hd) {
-    hd->setupSolver(radsolve::reltol, radsolve::abstol, radsolve::maxiter);
+    // With reuse_setup, a solver that is already set up only gets
+    // its matrix coefficients refreshed; the multigrid hierarchy and
+    // preconditioner from the last full setup are kept.
+    bool reuse = radsolve::reuse_setup == 1 && hd->solverIsSetup() && !force_setup;
+    if (hd->solverIsSetup() && !reuse) {
+      hd->clearSolver();
+    }
+    if (reuse) {
+      hd->loadMatrix();
+      num_reuses++;
+    }
+    else {
+      hd->setupSolver(radsolve::reltol, radsolve::abstol, radsolve::maxiter);
+      num_setups++;
+      force_setup = false;
+    }
+
+    Real mid_time = ParallelDescriptor::second();
+    setup_time += mid_time - strt_time;
+    strt_time = mid_time;
+
     hd->solve(Er, igroup, rhs, Inhomogeneous_BC);
+
+    if (radsolve::reuse_setup == 1) {
+      // Redo the full setup next time if the kept hierarchy has
+      // stopped being a good preconditioner for the current matrix.
+      int iters = hd->getNumIterations();
+      if (!reuse) {
+        setup_iterations = iters;
+      }
+      else if (iters > radsolve::reuse_setup_iter_factor * std::max(setup_iterations, 1)) {
+        force_setup = true;
+      }
+    }
+
     Real res = hd->getAbsoluteResidual();
     if (verbose >= 2 && ParallelDescriptor::IOProcessor()) {
       int oldprec = std::cout.precision(20);
@@ -615,7 +734,9 @@ void RadSolve::levelSolve(int level,
       std::cout.precision(oldprec);
     }
     res *= sync_absres_factor;
-    hd->clearSolver();
+    if (radsolve::reuse_setup != 1) {
+      hd->clearSolver();
+    }
   }
   else if (hm) {
     hm->loadMatrix();
@@ -623,6 +744,12 @@ void RadSolve::levelSolve(int level,
     hm->loadLevelVectors(level, Er, igroup, rhs, Inhomogeneous_BC);
     hm->finalizeVectors();
     hm->setupSolver(radsolve::reltol, radsolve::abstol, radsolve::maxiter);
+    num_setups++;
+
+    Real mid_time = ParallelDescriptor::second();
+    setup_time += mid_time - strt_time;
+    strt_time = mid_time;
+
     hm->solve();
     hm->getSolution(level, Er, igroup);
     Real res = hm->getAbsoluteResidual();
@@ -640,6 +767,12 @@ void RadSolve::levelSolve(int level,
     hem->loadLevelVectors(level, Er, igroup, rhs, Inhomogeneous_BC);
     hem->finalizeVectors();
     hem->setupSolver(radsolve::reltol, radsolve::abstol, radsolve::maxiter);
+    num_setups++;
+
+    Real mid_time = ParallelDescriptor::second();
+    setup_time += mid_time - strt_time;
+    strt_time = mid_time;
+
     hem->solve();
     hem->getSolution(level, Er, igroup);
     Real res = hem->getAbsoluteResidual();
@@ -651,6 +784,268 @@ void RadSolve::levelSolve(int level,
     res *= sync_absres_factor;
     hem->clearSolver();
   }
+  else
+#endif
+  if (use_mlmg) {
+    setupMLMG(level, Er, igroup);
+    num_setups++;
+
+    Real mid_time = ParallelDescriptor::second();
+    setup_time += mid_time - strt_time;
+    strt_time = mid_time;
+
+    MultiFab Er_g(Er, amrex::make_alias, igroup, 1);
+    mlmg->solve({&Er_g}, {&rhs}, radsolve::reltol, radsolve::abstol);
+    Real res = mlmg->getFinalResidual();
+    if (verbose >= 2 && ParallelDescriptor::IOProcessor()) {
+      int oldprec = std::cout.precision(20);
+      std::cout << "Absolute residual = " << res << std::endl;
+      std::cout.precision(oldprec);
+    }
+    res *= sync_absres_factor;
+    // The operator is kept until the next solve so that levelFlux
+    // can use it for the boundary fluxes.
+  }
+
+  solve_time += ParallelDescriptor::second() - strt_time;
+  num_solves++;
+}
+
+void RadSolve::reportSolverTimes(int level)
+{
+  if (verbose >= 1) {
+    Real times[2] = {setup_time, solve_time};
+    ParallelDescriptor::ReduceRealMax(times, 2, ParallelDescriptor::IOProcessorNumber());
+
+    amrex::Print() << "RadSolve level " << level << ": " << num_solves << " solves, "
+                   << num_setups << " full setups, " << num_reuses << " reused setups; "
+                   << "setup time = " << times[0] << ", solve time = " << times[1] << std::endl;
+  }
+
+  setup_time = 0.0;
+  solve_time = 0.0;
+  num_setups = 0;
+  num_reuses = 0;
+  num_solves = 0;
+}
+
+void RadSolve::setupMLMG(int level, const MultiFab& Er, int igroup)
+{
+  BL_PROFILE("RadSolve::setupMLMG");
+
+  if (mlmg_bndry == nullptr || !mlmg_acoefs) {
+    amrex::Abort("RadSolve::setupMLMG: boundary data and coefficients must be set before the solve");
+  }
+  for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+    if (!mlmg_bcoefs[idim]) {
+      amrex::Abort("RadSolve::setupMLMG: B coefficients must be set before the solve");
+    }
+  }
+
+  const NGBndry& bd = *mlmg_bndry;
+  const int bdcomp = mlmg_bdcomp;
+
+  const Geometry& geom = parent->Geom(level);
+  const BoxArray& grids = parent->boxArray(level);
+  const DistributionMapping& dmap = parent->DistributionMap(level);
+  const Box& domain = geom.Domain();
+  auto geomdata = geom.data();
+
+  // Domain boundary types.  The rhs and coefficients already carry
+  // the metric factors, so Neumann, Marshak and Sanchez-Pomraning
+  // boundaries become Robin conditions a E + b dE/dn = f (n the
+  // outward normal) with b the diffusion coefficient without the
+  // metric factors.  MLMG imposes the condition at the boundary face,
+  // taking E there as the average of the ghost and first interior
+  // cells; the Hypre solvers instead fold a one-sided closure into
+  // the boundary stencil.  The two discretizations agree only to the
+  // truncation error, so boundary fluxes and E in the cells next to
+  // these boundaries differ slightly from the Hypre results.
+
+  Array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc, mlmg_hibc;
+
+  for (OrientationIter oitr; oitr; ++oitr) {
+    const Orientation face = oitr();
+    const int idim = face.coordDir();
+
+    LinOpBCType bctype = LinOpBCType::Dirichlet;
+
+    if (geom.isPeriodic(idim)) {
+      bctype = LinOpBCType::Periodic;
+    }
+    else {
+      if (bd.mixedBndry(face)) {
+        amrex::Abort("RadSolve: radsolve.level_solver_flag = 200 does not support mixed boundary types");
+      }
+
+      // The type is the same for every grid that touches this face;
+      // if none do, it does not matter.
+      int bct = LO_DIRICHLET;
+      for (int i = 0; i < grids.size(); i++) {
+        if (grids[i][face] == domain[face]) {
+          bct = bd.bndryConds(face)[i];
+          break;
+        }
+      }
+
+      if (bct == LO_DIRICHLET) {
+        bctype = LinOpBCType::Dirichlet;
+      }
+      else if (bct == LO_REFLECT_ODD) {
+        bctype = LinOpBCType::reflect_odd;
+      }
+      else if (bct == LO_NEUMANN || bct == LO_MARSHAK || bct == LO_SANCHEZ_POMRANING) {
+        bctype = LinOpBCType::Robin;
+      }
+      else {
+        amrex::Abort("RadSolve: unsupported boundary type for radsolve.level_solver_flag = 200");
+      }
+
+      if (bct == LO_SANCHEZ_POMRANING && !mlmg_spa) {
+        amrex::Abort("RadSolve: Sanchez-Pomraning boundaries need levelSPas before the solve");
+      }
+    }
+
+    if (face.isLow()) {
+      mlmg_lobc[idim] = bctype;
+    }
+    else {
+      mlmg_hibc[idim] = bctype;
+    }
+  }
+
+  // Boundary values (in the ghost cells) and Robin coefficients.
+
+  MultiFab bcdata(grids, dmap, 1, 1);
+  MultiFab robin_a(grids, dmap, 1, 1);
+  MultiFab robin_b(grids, dmap, 1, 1);
+  MultiFab robin_f(grids, dmap, 1, 1);
+
+  bcdata.setVal(0.0);
+  robin_a.setVal(0.0);
+  robin_b.setVal(0.0);
+  robin_f.setVal(0.0);
+
+  MultiFab::Copy(bcdata, Er, igroup, 0, 1, 0);
+
+  const Real c = Radiation::c;
+  const bool have_spa = (mlmg_spa != nullptr);
+
+  for (MFIter mfi(bcdata); mfi.isValid(); ++mfi) {
+    const int i_grid = mfi.index();
+    const Box& reg = grids[i_grid];
+
+    for (OrientationIter oitr; oitr; ++oitr) {
+      const Orientation face = oitr();
+      const int idim = face.coordDir();
+
+      if (reg[face] != domain[face] || geom.isPeriodic(idim)) {
+        continue;
+      }
+
+      const int bct = bd.bndryConds(face)[i_grid];
+      const Box gbx = amrex::adjCell(reg, face);
+
+      // Offsets from the ghost cell to the boundary face and to the
+      // first interior cell.
+      const int fshift = face.isLow() ? 1 : 0;
+      const int cshift = face.isLow() ? 1 : -1;
+      const int di = (idim == 0);
+      const int dj = (idim == 1);
+      const int dk = (idim == 2);
+
+      auto bcv = bd.bndryValues(face)[mfi].const_array(bdcomp);
+      auto bc_arr = bcdata[mfi].array();
+      auto ra = robin_a[mfi].array();
+      auto rb = robin_b[mfi].array();
+      auto rf = robin_f[mfi].array();
+      auto bcoef = mlmg_bcoefs[idim]->const_array(mfi);
+      auto spa = have_spa ? mlmg_spa->const_array(mfi) : Array4<Real const>{};
+
+      amrex::ParallelFor(gbx,
+      [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+      {
+          bc_arr(i,j,k) = bcv(i,j,k);
+
+          if (bct == LO_DIRICHLET || bct == LO_REFLECT_ODD) {
+              return;
+          }
+
+          const int fi = i + fshift * di;
+          const int fj = j + fshift * dj;
+          const int fk = k + fshift * dk;
+
+          Real r, s;
+          edge_center_metric(fi, fj, fk, idim, geomdata, r, s);
+
+          if (AMREX_SPACEDIM == 1) {
+              s = 1.e0_rt;
+          }
+
+          // Guard against r = 0 on the axis and a vanishing limiter.
+          Real D = (r * s > 0.0_rt) ? bcoef(fi,fj,fk) / (r * s) : bcoef(fi,fj,fk);
+          rb(i,j,k) = amrex::max(D, 1.e-50_rt);
+
+          if (bct == LO_NEUMANN) {
+              ra(i,j,k) = 0.0_rt;
+              rf(i,j,k) = bcv(i,j,k);
+          }
+          else if (bct == LO_MARSHAK) {
+              ra(i,j,k) = 0.5_rt * c;
+              rf(i,j,k) = 2.0_rt * bcv(i,j,k);
+          }
+          else {
+              ra(i,j,k) = 2.0_rt * c * spa(i + cshift * di, j + cshift * dj, k + cshift * dk);
+              rf(i,j,k) = 2.0_rt * bcv(i,j,k);
+          }
+      });
+    }
+  }
+
+  // Build the operator.  The old solver refers to the old operator,
+  // so clear it first.
+
+  mlmg.reset();
+
+  LPInfo info;
+  info.setMetricTerm(false);
+
+  mlabec.reset(new MLABecLaplacian({geom}, {grids}, {dmap}, info));
+
+  mlabec->setDomainBC(mlmg_lobc, mlmg_hibc);
+
+  if (level > 0) {
+    // Coarse-fine boundary values come from the coarse level at the
+    // boundary data time, or are zero for a correction solve.
+    const BoxArray& cgrids = parent->boxArray(level-1);
+    const DistributionMapping& cdmap = parent->DistributionMap(level-1);
+    if (!mlmg_crse || mlmg_crse->boxArray() != cgrids ||
+        mlmg_crse->DistributionMap() != cdmap) {
+      mlmg_crse.reset(new MultiFab(cgrids, cdmap, 1, 0));
+    }
+    if (mlmg_correction) {
+      mlmg_crse->setVal(0.0);
+    }
+    else {
+      AmrLevel::FillPatch(parent->getLevel(level-1), *mlmg_crse, 0,
+                          mlmg_bndry_time, Rad_Type, igroup, 1);
+    }
+
+    const auto& rr = parent->refRatio(level-1);
+    mlabec->setCoarseFineBC(mlmg_crse.get(), rr[0]);
+  }
+
+  mlabec->setLevelBC(0, &bcdata, &robin_a, &robin_b, &robin_f);
+
+  mlabec->setScalars(radsolve::alpha, radsolve::beta);
+  mlabec->setACoeffs(0, *mlmg_acoefs);
+  mlabec->setBCoeffs(0, Array<MultiFab const*, AMREX_SPACEDIM>{AMREX_D_DECL(mlmg_bcoefs[0].get(),
+                                                                           mlmg_bcoefs[1].get(),
+                                                                           mlmg_bcoefs[2].get())});
+
+  mlmg.reset(new MLMG(*mlabec));
+  mlmg->setVerbose(verbose - 1);
+  mlmg->setMaxIter(radsolve::maxiter);
 }
 
 void RadSolve::levelFluxFaceToCenter(int level, const Array<MultiFab, AMREX_SPACEDIM>& Flux,
@@ -706,6 +1101,18 @@ void RadSolve::levelFlux(int level,
   const BoxArray& grids = parent->boxArray(level);
   const DistributionMapping& dmap = parent->DistributionMap(level);
 
+  if (use_mlmg) {
+    // The MLMG operator from the last solve knows the physical and
+    // coarse-fine boundary conditions, so it gives all the fluxes.
+    AMREX_ALWAYS_ASSERT(mlmg);
+    MultiFab Ersol(grids, dmap, 1, 1);
+    Ersol.setVal(0.0);
+    MultiFab::Copy(Ersol, Er, igroup, 0, 1, 0);
+    mlmg->getFluxes({{AMREX_D_DECL(&Flux[0], &Flux[1], &Flux[2])}}, {&Ersol});
+    return;
+  }
+
+#ifdef AMREX_USE_HYPRE
   // grow a larger MultiFab to hold Er so we can difference across faces
   MultiFab Erborder(grids, dmap, 1, 1);
   Erborder.setVal(0.0);
@@ -787,6 +1194,7 @@ void RadSolve::levelFlux(int level,
   else if (hm) {
     hm->boundaryFlux(level, &Flux[0], Er, igroup, Inhomogeneous_BC);
   }
+#endif
 }
 
 void RadSolve::levelFluxReg(int level,
@@ -821,6 +1229,9 @@ void RadSolve::levelFluxReg(int level,
 void RadSolve::levelDterm(int level, MultiFab& Dterm, MultiFab& Er, int igroup)
 {
   BL_PROFILE("RadSolve::levelDterm");
+#ifndef AMREX_USE_HYPRE
+  amrex::Abort("RadSolve::levelDterm: the nonsymmetric terms need USE_HYPRE = TRUE");
+#else
   const BoxArray& grids = parent->boxArray(level);
   const DistributionMapping& dmap = parent->DistributionMap(level);
   const Geometry& geom = parent->Geom(level);
@@ -946,6 +1357,7 @@ void RadSolve::levelDterm(int level, MultiFab& Dterm, MultiFab& Er, int igroup)
           });
       }
   }
+#endif
 }
 
 // <MGFLD routines>
@@ -1054,6 +1466,7 @@ void RadSolve::levelACoeffs(int level, MultiFab& kpp,
   }
 
   // set a coefficients
+#ifdef AMREX_USE_HYPRE
   if (hd) {
     hd->aCoefficients(acoefs);
   }
@@ -1063,6 +1476,11 @@ void RadSolve::levelACoeffs(int level, MultiFab& kpp,
   else if (hem) {
     hem->aCoefficients(level,acoefs);
   }
+  else
+#endif
+  if (use_mlmg) {
+    keep_coeffs(mlmg_acoefs, acoefs);
+  }
 }
 
 
@@ -1127,20 +1545,24 @@ void RadSolve::levelRhs(int level, MultiFab& rhs, const MultiFab& jg,
 
 void RadSolve::setHypreMulti(Real cMul, Real d1Mul, Real d2Mul)
 {
+#ifdef AMREX_USE_HYPRE
   if (hem) {
     hem-> cMultiplier() =  cMul;
     hem->d1Multiplier() = d1Mul;
     hem->d2Multiplier() = d2Mul;
   }
+#endif
 }
 
 void RadSolve::restoreHypreMulti()
 {
+#ifdef AMREX_USE_HYPRE
   if (hem) {
     hem-> cMultiplier() =  cMulti;
     hem->d1Multiplier() = d1Multi;
     hem->d2Multiplier() = d2Multi;  
   }
+#endif
 }
 
 void RadSolve::getCellCenterMetric(const Geometry& geom, const Box& reg, Vector<Real>& r, Vector<Real>& s)
@@ -328,8 +328,10 @@ Radiation::Radiation(Amr* Parent, Castro* castro, int restart)
     // every instance of Hypre must use the same factor (or
     // be responsible for changing it internally).
 
+#ifdef AMREX_USE_HYPRE
     HypreABec::fluxFactor() = c;
     HypreMultiABec::fluxFactor() = c;
+#endif
 
   }
 
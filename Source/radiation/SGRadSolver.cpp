@@ -410,6 +410,8 @@ void Radiation::single_group_update(int level, int iteration, int ncycle)
       }
   }
 
+  solver->reportSolverTimes(level);
+
   if (verbose && ParallelDescriptor::IOProcessor()) {
     std::cout << "                                     done" << std::endl;
   }
@@ -2,6 +2,7 @@
 
 #include <cstdio>
 #include <iostream>
+#include <string>
 using std::cout;
 using std::cerr;
 using std::endl;
@@ -26,18 +27,26 @@ Castro::do_energy_diagnostics()
 
     Real m = 0.0, s = 0.0, r = 0.0, rr = 0.0, rry = 0.0;
 
+    // the radiation energy is not part of the state, so it is derived,
+    // but it still shares the single reduction with the fluid sums
+
+    Vector<std::string> sum_names = {"density", "rho_E"};
+    if (!Radiation::do_multigroup) {
+        sum_names.push_back("rad");
+    }
+    else {
+        for (int igroup = 0; igroup < Radiation::nGroups; igroup++) {
+            sum_names.push_back("rad" + std::to_string(igroup));
+        }
+    }
+    Vector<Real> sums;
+
     for (int lev = 0; lev <= finest_level; lev++) {
-      m += getLevel(lev).volWgtSum("density", prev_time + dt);
-      s += getLevel(lev).volWgtSum("rho_E",   prev_time + dt);
-      if (!Radiation::do_multigroup) {
-          r += getLevel(lev).volWgtSum("rad", prev_time + dt);
-      }
-      else {
-          char rad_name[10];
-          for (int igroup = 0; igroup < Radiation::nGroups; igroup++) {
-              sprintf(rad_name, "rad%d", igroup);
-              r += getLevel(lev).volWgtSum(rad_name, prev_time + dt);
-          }
+      getLevel(lev).volWgtSums(sum_names, prev_time + dt, sums);
+      m += sums[0];
+      s += sums[1];
+      for (int n = 2; n < static_cast<int>(sum_names.size()); n++) {
+          r += sums[n];
       }
       if (lev < finest_level) {
           // If using deferred sync, also include flux register energy
@@ -90,9 +99,12 @@ Castro::do_energy_diagnostics()
     Real dt = parent->dtLevel(level);
 
     Real m = 0.0, s = 0.0;
+    const Vector<std::string> sum_names = {"density", "rho_E"};
+    Vector<Real> sums;
     for (int lev = 0; lev <= finest_level; lev++) {
-      m += getLevel(lev).volWgtSum("density", prev_time + dt);
-      s += getLevel(lev).volWgtSum("rho_E",   prev_time + dt);
+      getLevel(lev).volWgtSums(sum_names, prev_time + dt, sums);
+      m += sums[0];
+      s += sums[1];
     }
     if (ParallelDescriptor::IOProcessor()) {
       int oldprec = cout.precision(20);
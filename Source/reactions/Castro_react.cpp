@@ -60,16 +60,26 @@ Castro::react_state(MultiFab& s, MultiFab& r, Real time, Real dt)
     ReduceData<Real> reduce_data(reduce_op);
     using ReduceTuple = typename decltype(reduce_data)::Type;
 
+    // Record the zones that fail to burn if we may do a localized retry.
+
+    const bool tag_failures = retry_local == 1 && retry_tags.boxArray() == s.boxArray() &&
+                              retry_tags.DistributionMap() == s.DistributionMap();
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     for (MFIter mfi(s, TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
 
+        if (!retry_box_is_active(mfi.index())) {
+            continue;
+        }
+
         const Box& bx = mfi.growntilebox(ng);
 
         auto U = s.array(mfi);
         auto reactions = r.array(mfi);
+        auto tags = tag_failures ? retry_tags.array(mfi) : Array4<int>{};
 
         reduce_op.eval(bx, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
@@ -127,6 +137,10 @@ Castro::react_state(MultiFab& s, MultiFab& r, Real time, Real dt)
 
             if (!burn_state.success) {
                 burn_failed = 1.0_rt;
+
+                if (tags.contains(i,j,k)) {
+                    tags(i,j,k) = 1;
+                }
             }
 
             if (do_burn) {
@@ -610,3 +624,156 @@ Castro::valid_zones_to_burn(MultiFab& State)
     return false;
 
 }
+
+int
+Castro::WorkEstType ()
+{
+    if (burn_load_balance == 1) {
+        return Work_Estimate_Type;
+    }
+
+    return -1;
+}
+
+void
+Castro::update_burn_work_estimate()
+{
+    BL_PROFILE("Castro::update_burn_work_estimate()");
+
+    MultiFab& W = get_new_data(Work_Estimate_Type);
+
+    MultiFab& R_new = get_new_data(Reactions_Type);
+
+    // For the Strang-split burn, the first half of the burn is
+    // stored in the old-time reactions data and the second half in
+    // the new-time data. For simplified SDC there is only one burn.
+
+    const bool use_old = time_integration_method != SimplifiedSpectralDeferredCorrections &&
+                         state[Reactions_Type].hasOldData();
+
+    MultiFab& R_old = use_old ? get_old_data(Reactions_Type) : R_new;
+
+    // Exponential moving average, so that the estimate has a memory
+    // of roughly burn_load_balance_nsteps timesteps.
+
+    const Real alpha = 1.0_rt / static_cast<Real>(amrex::max(1, burn_load_balance_nsteps));
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(W, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto w = W.array(mfi);
+        auto r_new = R_new.const_array(mfi);
+        auto r_old = R_old.const_array(mfi);
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+            Real cost = r_new(i,j,k,1);
+
+            if (use_old) {
+                cost += r_old(i,j,k,1);
+            }
+
+            // Every zone costs at least one unit of work, even if it doesn't burn.
+
+            cost = amrex::max(1.0_rt, cost);
+
+            w(i,j,k) = (1.0_rt - alpha) * w(i,j,k) + alpha * cost;
+        });
+    }
+}
+
+Vector<Real>
+Castro::burn_work_per_box()
+{
+    BL_PROFILE("Castro::burn_work_per_box()");
+
+    const MultiFab& W = get_new_data(Work_Estimate_Type);
+
+    Vector<Real> cost(W.size(), 0.0_rt);
+
+    for (MFIter mfi(W); mfi.isValid(); ++mfi) {
+        cost[mfi.index()] = W[mfi].sum<RunOn::Device>(mfi.validbox(), 0);
+    }
+
+    ParallelDescriptor::ReduceRealSum(cost.dataPtr(), cost.size());
+
+    return cost;
+}
+
+Real
+Castro::burn_load_imbalance(const Vector<Real>& cost, const DistributionMapping& dm)
+{
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    Vector<Real> rank_cost(nprocs, 0.0_rt);
+
+    for (int i = 0; i < cost.size(); ++i) {
+        rank_cost[dm[i]] += cost[i];
+    }
+
+    Real max_cost = 0.0_rt;
+    Real total_cost = 0.0_rt;
+
+    for (int n = 0; n < nprocs; ++n) {
+        max_cost = amrex::max(max_cost, rank_cost[n]);
+        total_cost += rank_cost[n];
+    }
+
+    if (total_cost <= 0.0_rt) {
+        return 1.0_rt;
+    }
+
+    return max_cost * static_cast<Real>(nprocs) / total_cost;
+}
+
+void
+Castro::burn_load_balance_levels(Amr& amr)
+{
+    BL_PROFILE("Castro::burn_load_balance_levels()");
+
+    const int finest_level = amr.finestLevel();
+
+    // The coarsest level that was redistributed.
+
+    int lbase = finest_level + 1;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+
+        Castro& castro_level = dynamic_cast<Castro&>(amr.getLevel(lev));
+
+        const Vector<Real> cost = castro_level.burn_work_per_box();
+
+        const DistributionMapping& dm_old = castro_level.DistributionMap();
+        const Real imbalance_old = burn_load_imbalance(cost, dm_old);
+
+        DistributionMapping dm_new = DistributionMapping::makeKnapSack(cost);
+        const Real imbalance_new = burn_load_imbalance(cost, dm_new);
+
+        const bool accept = imbalance_new * burn_load_balance_threshold <= imbalance_old;
+
+        if (verbose) {
+            amrex::Print() << "... burn load balancing on level " << lev
+                           << ": imbalance before = " << imbalance_old
+                           << ", after = " << (accept ? imbalance_new : imbalance_old)
+                           << (accept ? "" : " (new distribution rejected)") << std::endl;
+        }
+
+        if (accept) {
+            amr.InstallNewDistributionMap(lev, dm_new);
+            lbase = amrex::min(lbase, lev);
+        }
+
+    }
+
+    // Now that all of the levels have their new distribution, let them
+    // rebuild anything that depends on it, as is done after a regrid.
+
+    for (int lev = lbase; lev <= finest_level; ++lev) {
+        amr.getLevel(lev).post_regrid(lbase, finest_level);
+    }
+}
@@ -5,6 +5,81 @@
 
 using namespace amrex;
 
+void
+Castro::expand_state_at_node(MultiFab& S, int state_index, int m, int ng)
+{
+
+    BL_PROFILE("Castro::expand_state_at_node()");
+
+    BL_ASSERT(S.nGrow() >= ng);
+
+    StateData& sd = state[state_index];
+
+    const Real prev_time = sd.prevTime();
+    const Real cur_time = sd.curTime();
+
+    if (m == 0) {
+        // the first node is the start of the step, which is exactly
+        // what the old-time data holds, here and on the coarser levels
+        AmrLevel::FillPatch(*this, S, ng, prev_time, state_index, 0, S.nComp());
+        return;
+    }
+
+    // Relabel the new-time data as living at the node time, so that
+    // the fill takes this level's data from it alone, while the coarser
+    // level is interpolated in time to the node.
+
+    const Real node_time = prev_time + dt_sdc[m] * (cur_time - prev_time);
+
+    sd.setNewTimeLevel(node_time);
+
+    AmrLevel::FillPatch(*this, S, ng, node_time, state_index, 0, S.nComp());
+
+    sd.setNewTimeLevel(cur_time);
+
+}
+
+
+
+Real
+Castro::sdc_flux_weight(int m) const
+{
+
+    // On the last iteration the state is advanced node to node as
+    //
+    //   U_{m+1} = U_m + dt_m (A_m - A_m^old) + I_m^{m+1}(A^old),
+    //
+    // where the old terms come from the previous iteration.  Summed
+    // over the nodes, the flux that was applied is
+    //
+    //   sum_m (dt_m / dt) (F_m - F_m^old) + sum_m w_m F_m^old,
+    //
+    // so we weight the fluxes of the next-to-last iteration by
+    // w_m - dt_m / dt and those of the last iteration by dt_m / dt.
+    // The first node never changes and is only evaluated on the first
+    // iteration, so it carries its full quadrature weight there.
+
+    const int last_iteration = sdc_order + sdc_extra - 1;
+
+    if (m == 0) {
+        return sdc_iteration == 0 ? node_weights[0] : 0.0_rt;
+    }
+
+    const Real dt_frac = (m < SDC_NODES - 1) ? dt_sdc[m+1] - dt_sdc[m] : 0.0_rt;
+
+    if (sdc_iteration == last_iteration - 1) {
+        return node_weights[m] - dt_frac;
+    }
+    else if (sdc_iteration == last_iteration) {
+        return dt_frac;
+    }
+
+    return 0.0_rt;
+
+}
+
+
+
 void
 Castro::do_sdc_update(int m_start, int m_end, Real dt)
 {
@@ -44,7 +119,10 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
         // for 4th order reacting flow, we need to create the "source" C
         // as averages and then convert it to cell centers.  The cell-center
         // version needs to have 2 ghost cells
-        for (MFIter mfi(*k_new[0]); mfi.isValid(); ++mfi)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(*k_new[0], TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
 
             const Box& bx = mfi.tilebox();
@@ -80,7 +158,9 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
         }
 
         // need to construct the time for this stage -- but it is not really
-        // at a single instance in time.  For single level this does not matter,
+        // at a single instance in time.  The ghost cells only enter the
+        // h**2/24 Laplacian correction when converting C to centers, so
+        // at a coarse-fine boundary the coarse level's C is adequate.
         Real time = state[SDC_Source_Type].curTime();
         AmrLevel::FillPatch(*this, C_source, C_source.nGrow(), time,
                             SDC_Source_Type, 0, NUM_STATE);
@@ -91,7 +171,10 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
         // staging place so we can do a FillPatch
         MultiFab& S_new = get_new_data(State_Type);
 
-        for (MFIter mfi(S_new); mfi.isValid(); ++mfi)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
 
             const Box& bx = mfi.tilebox();
@@ -111,14 +194,20 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
 
         }
 
-        const Real cur_time = state[State_Type].curTime();
-        expand_state(Sburn, cur_time, 2);
+        expand_state_at_node(Sburn, State_Type, m_end, 2);
 
     }
 #endif
 
     // main update loop -- we are updating k_new[m_start] to
-    // k_new[m_end]
+    // k_new[m_end].  The fourth order conversions all work on per-tile
+    // temporaries that include the one ghost cell they need, so this
+    // can be tiled.
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
 
     FArrayBox U_center;
     FArrayBox C_center;
@@ -128,11 +217,14 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
 
     FArrayBox C2;
 
-    for (MFIter mfi(*k_new[0]); mfi.isValid(); ++mfi)
+    for (MFIter mfi(*k_new[0], TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
 
         const Box& bx = mfi.tilebox();
-        const Box& bx1 = mfi.growntilebox(1);
+        // the Laplacian in make_fourth_in_place needs the per-tile
+        // temporaries on one zone around the tile, including at tile
+        // boundaries interior to the box (which growntilebox does not grow)
+        const Box& bx1 = amrex::grow(bx, 1);
 
 #ifdef REACTIONS
         // advection + reactions
@@ -327,6 +419,8 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
 #endif
 
     }
+
+    }
 }
 
 
@@ -344,18 +438,26 @@ Castro::construct_old_react_source(MultiFab& U_state,
 
     if (sdc_order == 4 && input_is_average)
     {
-        // we have cell-averages
-        // Note: we cannot tile these operations
+        // we have cell-averages.  We write into Sburn below, so it
+        // cannot also be the input when tiling.
+
+        BL_ASSERT(&U_state != &Sburn);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
 
         FArrayBox U_center;
         FArrayBox R_center;
         FArrayBox tmp;
 
-        for (MFIter mfi(U_state); mfi.isValid(); ++mfi)
+        for (MFIter mfi(U_state, TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
 
             const Box& bx = mfi.tilebox();
-            const Box& obx = mfi.growntilebox(1);
+            const Box& obx = amrex::grow(bx, 1);
+            const Box& gbx = mfi.growntilebox(1);
 
             // Convert to centers
             U_center.resize(obx, NUM_STATE);
@@ -380,8 +482,9 @@ Castro::construct_old_react_source(MultiFab& U_state,
 
             // at this point, we have the reaction term on centers,
             // including a ghost cell.  Save this into Sburn so we can use
-            // it later for the plotfile filling
-            Sburn[mfi].copy(R_center, obx, 0, obx, 0, NUM_STATE);
+            // it later for the plotfile filling -- the grown tile boxes
+            // do not overlap, so each zone is written by one tile
+            Sburn[mfi].copy(R_center, gbx, 0, gbx, 0, NUM_STATE);
 
             // convert R to averages (in place)
 
@@ -395,6 +498,8 @@ Castro::construct_old_react_source(MultiFab& U_state,
             R_source[mfi].copy(R_center, bx, 0, bx, 0, NUM_STATE);
         }
 
+        }
+
     }
     else
     {
@@ -1,5 +1,6 @@
 #include "Castro.H"
 #include "Castro_F.H"
+#include "geom_sources.H"
 
 using namespace amrex;
 
@@ -121,12 +122,6 @@ Castro::fill_geom_source (Real time, Real dt,
   // resulting from taking the divergence of (rho U U) in cylindrical
   // coordinates.  See the paper by Bernard-Champmartin
 
-  auto dx = geom.CellSizeArray();
-  auto prob_lo = geom.ProbLoArray();
-
-  auto coord = geom.Coord();
-
-
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -134,23 +129,26 @@ Castro::fill_geom_source (Real time, Real dt,
 
     const Box& bx = mfi.tilebox();
 
-    Array4<Real const> const U_arr = state.array(mfi);
+    add_geom_source(bx, state.array(mfi), geom_src.array(mfi), 1.0_rt);
 
-    Array4<Real> const src = geom_src.array(mfi);
+  }
+}
 
-    amrex::ParallelFor(bx,
-    [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
-    {
 
-      // radius for non-Cartesian
-      Real r = prob_lo[0] + (static_cast<Real>(i) + 0.5_rt)*dx[0];
 
-      // radial momentum: F = rho v_phi**2 / r
-      src(i,j,k,UMX) = U_arr(i,j,k,UMZ) * U_arr(i,j,k,UMZ) / (U_arr(i,j,k,URHO) * r);
+void
+Castro::add_geom_source (const Box& bx,
+                         Array4<Real const> const& U_arr,
+                         Array4<Real> const& src,
+                         Real mult_factor)
+{
 
-      // azimuthal momentum: F = - rho v_r v_phi / r
-      src(i,j,k,UMZ) = - U_arr(i,j,k,UMX) * U_arr(i,j,k,UMZ) / (U_arr(i,j,k,URHO) * r);
+  auto dx = geom.CellSizeArray();
+  auto prob_lo = geom.ProbLoArray();
 
-    });
-  }
+  amrex::ParallelFor(bx,
+  [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+  {
+    geom_source_zone(i, j, k, U_arr, src, mult_factor, dx, prob_lo);
+  });
 }
@@ -1,10 +1,23 @@
 #include <Castro.H>
 #include <Castro_F.H>
+#include <geom_sources.H>
 
 #ifdef RADIATION
 #include <Radiation.H>
 #endif
 
+#ifdef SPONGE
+#include <sponge_sources.H>
+#endif
+
+#ifdef GRAVITY
+#include <gravity_sources.H>
+#endif
+
+#ifdef ROTATION
+#include <rotation_sources.H>
+#endif
+
 using namespace amrex;
 
 void
@@ -120,6 +133,13 @@ Castro::do_old_sources(
     source.setVal(0.0, source.nGrow());
 
     for (int n = 0; n < num_src; ++n) {
+
+        // Pointwise sources are done together below if we are fusing them.
+
+        if (fuse_sources && source_flag(n) && source_is_pointwise(n)) {
+            continue;
+        }
+
         construct_old_source(n, source, state_old, time, dt);
 
         // We can either apply the sources to the state one by one, or we can
@@ -127,6 +147,21 @@ Castro::do_old_sources(
 
     }
 
+    if (fuse_sources) {
+        construct_old_pointwise_sources(source, state_old, time, dt);
+    }
+
+    // Optionally compare the fused and unfused pointwise sources. This
+    // only touches scratch data, and it is not counted in the stage time.
+
+    Real bench_time = 0.0;
+
+    if (source_benchmark > 0) {
+        const Real bench_strt = ParallelDescriptor::second();
+        benchmark_pointwise_sources(source, state_old, state_new, time, dt, false);
+        bench_time = ParallelDescriptor::second() - bench_strt;
+    }
+
     if (apply_to_state) {
 
         apply_source_to_state(state_new, source, dt, 0);
@@ -149,7 +184,7 @@ Castro::do_old_sources(
     if (verbose > 0)
     {
         const int IOProc   = ParallelDescriptor::IOProcessorNumber();
-        Real      run_time = ParallelDescriptor::second() - strt_time;
+        Real      run_time = ParallelDescriptor::second() - strt_time - bench_time;
 
 #ifdef BL_LAZY
         Lazy::QueueReduction( [=] () mutable {
@@ -182,6 +217,13 @@ Castro::do_new_sources(
     // Construct the new-time source terms.
 
     for (int n = 0; n < num_src; ++n) {
+
+        // Pointwise sources are done together below if we are fusing them.
+
+        if (fuse_sources && source_flag(n) && source_is_pointwise(n)) {
+            continue;
+        }
+
         construct_new_source(n, source, state_old, state_new, time, dt);
 
         // We can either apply the sources to the state one by one, or we can
@@ -189,6 +231,21 @@ Castro::do_new_sources(
 
     }
 
+    if (fuse_sources) {
+        construct_new_pointwise_sources(source, state_old, state_new, time, dt);
+    }
+
+    // Optionally compare the fused and unfused pointwise sources. This
+    // has to happen before the source is applied to state_new.
+
+    Real bench_time = 0.0;
+
+    if (source_benchmark > 0) {
+        const Real bench_strt = ParallelDescriptor::second();
+        benchmark_pointwise_sources(source, state_old, state_new, time, dt, true);
+        bench_time = ParallelDescriptor::second() - bench_strt;
+    }
+
     if (apply_to_state) {
 
         apply_source_to_state(state_new, source, dt, 0);
@@ -211,7 +268,7 @@ Castro::do_new_sources(
     if (verbose > 0)
     {
         const int IOProc   = ParallelDescriptor::IOProcessorNumber();
-        Real      run_time = ParallelDescriptor::second() - strt_time;
+        Real      run_time = ParallelDescriptor::second() - strt_time - bench_time;
 
 #ifdef BL_LAZY
         Lazy::QueueReduction( [=] () mutable {
@@ -346,6 +403,328 @@ Castro::construct_new_source(int src, MultiFab& source, MultiFab& state_old, Mul
     } // end switch
 }
 
+bool
+Castro::source_is_pointwise(int src)
+{
+    switch(src) {
+
+#ifdef SPONGE
+    case sponge_src:
+        return true;
+#endif
+
+    case geom_src:
+        return true;
+
+#ifdef GRAVITY
+    case grav_src:
+        return true;
+#endif
+
+#ifdef ROTATION
+    case rot_src:
+        return true;
+#endif
+
+    default:
+        return false;
+
+    } // end switch
+}
+
+void
+Castro::construct_old_pointwise_sources(MultiFab& source, MultiFab& state_in, Real time, Real dt)
+{
+    BL_PROFILE("Castro::construct_old_pointwise_sources()");
+
+    // This is the same as calling construct_old_source for each of
+    // the pointwise sources, but with a single kernel per tile: each
+    // zone has all of its sources added while its state is loaded.
+    // There is no old-time sponge source.
+
+    const bool do_geom_src = source_flag(geom_src) && use_axisymmetric_geom_source;
+
+    const auto dx = geom.CellSizeArray();
+    const auto prob_lo = geom.ProbLoArray();
+    const GeometryData geomdata = geom.data();
+
+#ifdef GRAVITY
+    const bool do_grav_src = source_flag(grav_src);
+    if (do_grav_src) {
+        AMREX_ALWAYS_ASSERT(castro::grav_source_type >= 1 && castro::grav_source_type <= 4);
+    }
+    const MultiFab& grav_old = get_old_data(Gravity_Type);
+#endif
+
+#ifdef ROTATION
+    const bool do_rot_src = source_flag(rot_src);
+    if (do_rot_src) {
+        fill_rotation_field(get_old_data(PhiRot_Type), state_in, time);
+    }
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(state_in, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        Array4<Real const> const uold = state_in.array(mfi);
+        Array4<Real> const src = source.array(mfi);
+
+#ifdef GRAVITY
+        Array4<Real const> const gold = grav_old.array(mfi);
+#endif
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+#ifdef GRAVITY
+            if (do_grav_src) {
+                gravity_source_zone(i, j, k, uold, gold, src, dt, geomdata);
+            }
+#endif
+
+#ifdef ROTATION
+            if (do_rot_src) {
+                rotation_source_zone(i, j, k, uold, src, dt, geomdata);
+            }
+#endif
+
+            if (do_geom_src) {
+                geom_source_zone(i, j, k, uold, src, 1.0_rt, dx, prob_lo);
+            }
+        });
+    }
+}
+
+void
+Castro::construct_new_pointwise_sources(MultiFab& source, MultiFab& state_old, MultiFab& state_new, Real time, Real dt)
+{
+    BL_PROFILE("Castro::construct_new_pointwise_sources()");
+
+    // This is the same as calling construct_new_source for each of
+    // the pointwise sources, but with a single kernel per tile.
+
+    const bool do_geom_src = source_flag(geom_src) && use_axisymmetric_geom_source;
+
+    const auto dx = geom.CellSizeArray();
+    const auto prob_lo = geom.ProbLoArray();
+    const GeometryData geomdata = geom.data();
+
+#ifdef SPONGE
+    const bool do_sponge_src = source_flag(sponge_src);
+    const Real alpha = sponge_alpha(dt);
+#endif
+
+#ifdef GRAVITY
+    const bool do_grav_src = source_flag(grav_src);
+    if (do_grav_src) {
+        AMREX_ALWAYS_ASSERT(castro::grav_source_type >= 1 && castro::grav_source_type <= 4);
+    }
+    const MultiFab& grav_old = get_old_data(Gravity_Type);
+    const MultiFab& grav_new = get_new_data(Gravity_Type);
+
+    GpuArray<Real, 3> dx3;
+    for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
+        dx3[idir] = dx[idir];
+    }
+    for (int idir = AMREX_SPACEDIM; idir < 3; ++idir) {
+        dx3[idir] = 0.0_rt;
+    }
+#endif
+
+#ifdef ROTATION
+    const bool do_rot_src = source_flag(rot_src);
+    const MultiFab& phirot_old = get_old_data(PhiRot_Type);
+    MultiFab& phirot_new = get_new_data(PhiRot_Type);
+    if (do_rot_src) {
+        fill_rotation_field(phirot_new, state_new, time);
+    }
+    const auto dt_omega_matrix = rotation_dt_omega_matrix(dt);
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(state_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        Array4<Real const> const uold = state_old.array(mfi);
+        Array4<Real const> const unew = state_new.array(mfi);
+        Array4<Real> const src = source.array(mfi);
+
+#if defined(GRAVITY) || defined(ROTATION)
+        Array4<Real const> const flux0 = (*mass_fluxes[0]).array(mfi);
+        Array4<Real const> const flux1 = (*mass_fluxes[1]).array(mfi);
+        Array4<Real const> const flux2 = (*mass_fluxes[2]).array(mfi);
+        Array4<Real const> const vol = volume.array(mfi);
+#endif
+
+#ifdef GRAVITY
+        Array4<Real const> const gold = grav_old.array(mfi);
+        Array4<Real const> const gnew = grav_new.array(mfi);
+#endif
+
+#ifdef ROTATION
+        Array4<Real const> const phi_old = phirot_old.array(mfi);
+        Array4<Real const> const phi_new = phirot_new.array(mfi);
+#endif
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+        {
+#ifdef SPONGE
+            if (do_sponge_src) {
+                sponge_source_zone(i, j, k, unew, src, dt, alpha, dx, prob_lo);
+            }
+#endif
+
+#ifdef GRAVITY
+            if (do_grav_src) {
+                gravity_corrector_zone(i, j, k, uold, unew, gold, gnew, src,
+                                       flux0, flux1, flux2, dt, vol, dx3, geomdata);
+            }
+#endif
+
+#ifdef ROTATION
+            if (do_rot_src) {
+                rotation_corrector_zone(i, j, k, phi_old, phi_new, uold, unew, src,
+                                        flux0, flux1, flux2, dt, vol, dt_omega_matrix, geomdata);
+            }
+#endif
+
+            if (do_geom_src) {
+                // Time center: subtract off half of the old-time value and
+                // add half of the new-time value.
+                geom_source_zone(i, j, k, uold, src, -0.5_rt, dx, prob_lo);
+                geom_source_zone(i, j, k, unew, src, 0.5_rt, dx, prob_lo);
+            }
+        });
+    }
+}
+
+void
+Castro::benchmark_pointwise_sources(const MultiFab& source, MultiFab& state_old, MultiFab& state_new,
+                                    Real time, Real dt, bool is_new)
+{
+    BL_PROFILE("Castro::benchmark_pointwise_sources()");
+
+    // The active pointwise sources for this stage. There is no
+    // old-time sponge source, so it doesn't count as a sweep there.
+
+    Vector<int> srcs;
+
+    for (int n = 0; n < num_src; ++n) {
+        if (!source_flag(n) || !source_is_pointwise(n)) {
+            continue;
+        }
+        if (n == geom_src && (geom.Coord() != 1 || !use_axisymmetric_geom_source)) {
+            continue;
+        }
+#ifdef SPONGE
+        if (n == sponge_src && !is_new) {
+            continue;
+        }
+#endif
+        srcs.push_back(n);
+    }
+
+    if (srcs.empty()) {
+        return;
+    }
+
+    MultiFab src_unfused(source.boxArray(), source.DistributionMap(), source.nComp(), 0);
+    MultiFab src_fused(source.boxArray(), source.DistributionMap(), source.nComp(), 0);
+
+    Real time_unfused = 0.0;
+    Real time_fused = 0.0;
+
+    for (int rep = 0; rep < source_benchmark; ++rep) {
+
+        // One kernel and one pass over the state per source, as with
+        // castro.fuse_sources = 0.
+
+        src_unfused.setVal(0.0);
+        Gpu::synchronize();
+
+        Real strt = ParallelDescriptor::second();
+
+        for (int n : srcs) {
+            if (is_new) {
+                construct_new_source(n, src_unfused, state_old, state_new, time, dt);
+            } else {
+                construct_old_source(n, src_unfused, state_old, time, dt);
+            }
+        }
+
+        Gpu::synchronize();
+        time_unfused += ParallelDescriptor::second() - strt;
+
+        // A single kernel per box, as with castro.fuse_sources = 1.
+
+        src_fused.setVal(0.0);
+        Gpu::synchronize();
+
+        strt = ParallelDescriptor::second();
+
+        if (is_new) {
+            construct_new_pointwise_sources(src_fused, state_old, state_new, time, dt);
+        } else {
+            construct_old_pointwise_sources(src_fused, state_old, time, dt);
+        }
+
+        Gpu::synchronize();
+        time_fused += ParallelDescriptor::second() - strt;
+
+    }
+
+    time_unfused /= source_benchmark;
+    time_fused /= source_benchmark;
+
+    // The two modes should give the same source to roundoff.
+
+    MultiFab::Subtract(src_unfused, src_fused, 0, 0, source.nComp(), 0);
+    Real max_diff = 0.0;
+    for (int n = 0; n < source.nComp(); ++n) {
+        max_diff = amrex::max(max_diff, src_unfused.norm0(n, 0, true));
+    }
+
+    // Model of the data streamed through memory, not a hardware
+    // measurement: every sweep reads each input state once and reads
+    // and writes the source once. Temporaries (the geometry source
+    // buffer, the rotation potential fill) are not counted.
+
+    const Real nzones = static_cast<Real>(source.boxArray().numPts());
+    const int nstate_in = is_new ? 2 : 1;
+    const Real bytes_per_sweep = nzones * sizeof(Real) *
+                                 (nstate_in * state_old.nComp() + 2 * source.nComp());
+
+    const Real bytes_unfused = bytes_per_sweep * srcs.size();
+    const Real bytes_fused = bytes_per_sweep;
+
+    const int IOProc = ParallelDescriptor::IOProcessorNumber();
+    const int nsrcs = srcs.size();
+
+    ParallelDescriptor::ReduceRealMax(time_unfused, IOProc);
+    ParallelDescriptor::ReduceRealMax(time_fused, IOProc);
+    ParallelDescriptor::ReduceRealMax(max_diff, IOProc);
+
+    if (ParallelDescriptor::IOProcessor()) {
+        const std::string stage = is_new ? "new" : "old";
+        std::cout << "Castro::benchmark_pointwise_sources() level " << level << ", "
+                  << stage << "-time stage, " << nsrcs << " pointwise sources, "
+                  << source_benchmark << " repetitions\n";
+        std::cout << "  unfused: " << nsrcs << " sweeps, time = " << time_unfused
+                  << " s, modeled bytes = " << bytes_unfused << "\n";
+        std::cout << "  fused:   1 sweep,  time = " << time_fused
+                  << " s, modeled bytes = " << bytes_fused << "\n";
+        std::cout << "  max |unfused - fused| = " << max_diff << "\n" << "\n";
+    }
+}
+
 // Returns whether any sources are actually applied.
 
 bool
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+
+"""Convert an initial model between the ASCII format read by
+model_parser.H and the binary format (see model_binary in
+model_parser.H).  The direction is detected from the input file:
+
+  convert_model.py model.txt model.bin    # ASCII -> binary
+  convert_model.py model.bin model.txt    # binary -> ASCII
+
+The CRC-32 of the output file is printed -- this is what Castro
+reports in the job_info file for the model.
+
+The binary file is written in the byte order of the machine running
+this script, which must match the machine running Castro.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"CASTROMD"
+VERSION = 1
+BYTE_ORDER = 0x01020304
+
+# relative tolerance for the check that the points are uniformly spaced
+# -- this matches set_model_spacing() in model_parser.H
+UNIFORM_TOL = 1.e-6
+
+
+def read_ascii(filename):
+    """return the variable names, the radii, and the data (a list of
+    rows, one per point) from an ASCII model file"""
+
+    with open(filename) as f:
+        npts = int(f.readline().split("=")[1])
+        nvars = int(f.readline().split("=")[1])
+
+        varnames = []
+        for _ in range(nvars):
+            varnames.append(f.readline().split("#", 1)[1].strip())
+
+        # the data can be split across lines in any way, so read it as
+        # one stream of numbers, like the C++ reader does
+        values = [float(v) for v in f.read().split()]
+
+    if len(values) < npts * (nvars + 1):
+        sys.exit(f"error: {filename} has fewer values than npts = {npts} requires")
+
+    r = []
+    data = []
+    for i in range(npts):
+        row = values[i*(nvars+1):(i+1)*(nvars+1)]
+        r.append(row[0])
+        data.append(row[1:])
+
+    return varnames, r, data
+
+
+def read_binary(filename):
+    """return the variable names, the radii, and the data from a binary
+    model file"""
+
+    with open(filename, "rb") as f:
+        buf = f.read()
+
+    offset = len(MAGIC)
+    version, byte_order, npts, nvars, _ = struct.unpack_from("=5i", buf, offset)
+    offset += struct.calcsize("=5i")
+
+    if version != VERSION:
+        sys.exit(f"error: unsupported binary model version {version}")
+    if byte_order != BYTE_ORDER:
+        sys.exit("error: binary model was written with a different byte order")
+
+    varnames = []
+    for _ in range(nvars):
+        (length,) = struct.unpack_from("=i", buf, offset)
+        offset += 4
+        varnames.append(buf[offset:offset+length].decode())
+        offset += length
+
+    r = list(struct.unpack_from(f"={npts}d", buf, offset))
+    offset += 8 * npts
+
+    flat = struct.unpack_from(f"={npts*nvars}d", buf, offset)
+    data = [list(flat[i*nvars:(i+1)*nvars]) for i in range(npts)]
+
+    return varnames, r, data
+
+
+def is_uniform(r):
+    """are the points uniformly spaced?"""
+
+    npts = len(r)
+    if npts < 3:
+        return False
+
+    dr = (r[-1] - r[0]) / (npts - 1)
+    if dr <= 0.0:
+        return False
+
+    return all(abs((r[i+1] - r[i]) - dr) <= UNIFORM_TOL * dr for i in range(npts-1))
+
+
+def write_binary(filename, varnames, r, data):
+
+    npts = len(r)
+    nvars = len(varnames)
+
+    with open(filename, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("=5i", VERSION, BYTE_ORDER, npts, nvars, int(is_uniform(r))))
+        for name in varnames:
+            encoded = name.encode()
+            f.write(struct.pack("=i", len(encoded)))
+            f.write(encoded)
+        f.write(struct.pack(f"={npts}d", *r))
+        for row in data:
+            f.write(struct.pack(f"={nvars}d", *row))
+
+
+def write_ascii(filename, varnames, r, data):
+
+    with open(filename, "w") as f:
+        f.write(f"# npts = {len(r)}\n")
+        f.write(f"# num of variables = {len(varnames)}\n")
+        for name in varnames:
+            f.write(f"# {name}\n")
+        for ri, row in zip(r, data):
+            f.write(" ".join(f"{v:24.17g}" for v in [ri] + row) + "\n")
+
+
+def main():
+
+    parser = argparse.ArgumentParser(description="convert an initial model between the ASCII and binary formats")
+    parser.add_argument("infile", help="the model to convert")
+    parser.add_argument("outfile", help="the converted model")
+    args = parser.parse_args()
+
+    with open(args.infile, "rb") as f:
+        binary = f.read(len(MAGIC)) == MAGIC
+
+    if binary:
+        varnames, r, data = read_binary(args.infile)
+        write_ascii(args.outfile, varnames, r, data)
+    else:
+        varnames, r, data = read_ascii(args.infile)
+        write_binary(args.outfile, varnames, r, data)
+
+    with open(args.outfile, "rb") as f:
+        crc = zlib.crc32(f.read())
+
+    print(f"{args.infile} -> {args.outfile}: {len(r)} points, {len(varnames)} variables, "
+          f"{'uniform' if is_uniform(r) else 'nonuniform'} spacing, CRC-32 = {crc:08x}")
+
+
+if __name__ == "__main__":
+    main()
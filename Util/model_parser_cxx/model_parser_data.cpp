@@ -9,4 +9,9 @@ namespace model
 
     AMREX_GPU_MANAGED amrex::Array1D<initial_model_t, 0, NUM_MODELS-1> profile;
 
+    AMREX_GPU_MANAGED amrex::Array1D<model_spacing_t, 0, NUM_MODELS-1> spacing;
+
+    std::string filename[NUM_MODELS];
+    std::uint32_t checksum[NUM_MODELS];
+
 }
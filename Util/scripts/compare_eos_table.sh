@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# Run a problem with the full EOS and with the tabulated EOS in the
+# hydro (castro.use_eos_table = 1), then report the run time of each
+# and the differences between the last plotfiles.
+#
+# usage: compare_eos_table.sh executable inputs [extra runtime parameters]
+#
+# The fcompare tool from AMReX (amrex/Tools/Plotfile) is used for the
+# plotfile comparison; set FCOMPARE if it is not fcompare.gnu.ex in
+# the PATH.
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 executable inputs [extra runtime parameters]"
+    exit 1
+fi
+
+EXE=$1
+INPUTS=$2
+shift 2
+
+FCOMPARE=${FCOMPARE:-fcompare.gnu.ex}
+
+name=$(basename ${INPUTS})
+
+for tab in 0 1; do
+    ${EXE} ${INPUTS} castro.use_eos_table=${tab} \
+           amr.plot_file=${name}_table${tab}_plt amr.checkpoint_files_output=0 \
+           "$@" > ${name}_table${tab}.out || exit 1
+
+    echo "castro.use_eos_table = ${tab}:"
+    grep "Run time without initialization" ${name}_table${tab}.out
+done
+
+echo
+grep -A1 "^EOS table" ${name}_table1.out
+
+plt0=$(ls -d ${name}_table0_plt* | grep -v old | tail -1)
+plt1=$(ls -d ${name}_table1_plt* | grep -v old | tail -1)
+
+echo
+echo "differences between ${plt0} and ${plt1}:"
+${FCOMPARE} ${plt0} ${plt1}